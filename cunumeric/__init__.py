@@ -31,6 +31,15 @@ from cunumeric.array import ndarray
 from cunumeric.module import *
 from cunumeric._ufunc import *
 from cunumeric.logic import *
+from cunumeric.npyio import (
+    genfromtxt,
+    load,
+    load_chunked,
+    loadtxt,
+    memmap,
+    save,
+    save_chunked,
+)
 from cunumeric.window import bartlett, blackman, hamming, hanning, kaiser
 from cunumeric.coverage import clone_module
 
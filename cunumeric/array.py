@@ -160,6 +160,7 @@ class ndarray:
         order=None,
         thunk=None,
         inputs=None,
+        op=None,
     ) -> None:
         # `inputs` being a cuNumeric ndarray is definitely a bug
         assert not isinstance(inputs, ndarray)
@@ -187,7 +188,9 @@ class ndarray:
                         for inp in inputs
                         if isinstance(inp, ndarray)
                     ]
-                self._thunk = runtime.create_empty_thunk(shape, dtype, inputs)
+                self._thunk = runtime.create_empty_thunk(
+                    shape, dtype, inputs, op
+                )
         else:
             self._thunk = thunk
         self._legate_data = None
@@ -2562,8 +2565,9 @@ class ndarray:
         Multiple GPUs, Multiple CPUs
 
         """
-        # Same as 'ravel' because cuNumeric creates a new array by 'reshape'
-        return self.reshape(-1, order=order)
+        # Whether reshape returns a view depends on the thunk (eager thunks
+        # follow NumPy), so always copy to never alias the source
+        return self.reshape(-1, order=order).copy()
 
     def getfield(self, dtype, offset=0):
         raise NotImplementedError(
@@ -3082,7 +3086,7 @@ class ndarray:
         Multiple GPUs, Single CPU
 
         """
-        result = ndarray(self.shape, np.int64)
+        result = ndarray(self.shape, np.int64, inputs=(self,), op="sort")
         result._thunk.sort(
             rhs=self._thunk, argsort=True, axis=axis, kind=kind, order=order
         )
@@ -31,6 +31,7 @@ if TYPE_CHECKING:
 class _CunumericSharedLib:
     CUNUMERIC_ADVANCED_INDEXING: int
     CUNUMERIC_ARANGE: int
+    CUNUMERIC_BATCHED_MATMUL: int
     CUNUMERIC_BINARY_OP: int
     CUNUMERIC_BINARY_RED: int
     CUNUMERIC_BINCOUNT: int
@@ -70,6 +71,7 @@ class _CunumericSharedLib:
     CUNUMERIC_BINOP_RIGHT_SHIFT: int
     CUNUMERIC_BINOP_SUBTRACT: int
     CUNUMERIC_CHOOSE: int
+    CUNUMERIC_CONCATENATE: int
     CUNUMERIC_CONTRACT: int
     CUNUMERIC_CONVERT: int
     CUNUMERIC_CONVOLVE: int
@@ -88,7 +90,14 @@ class _CunumericSharedLib:
     CUNUMERIC_FILL: int
     CUNUMERIC_FLIP: int
     CUNUMERIC_GEMM: int
+    CUNUMERIC_GEQRF: int
+    CUNUMERIC_GESVD: int
+    CUNUMERIC_GETRF: int
+    CUNUMERIC_GETRS: int
+    CUNUMERIC_LOAD_CHUNKS: int
     CUNUMERIC_LOAD_CUDALIBS: int
+    CUNUMERIC_LOAD_NPY: int
+    CUNUMERIC_LOAD_TEXT: int
     CUNUMERIC_MATMUL: int
     CUNUMERIC_MATVECMUL: int
     CUNUMERIC_MAX_MAPPERS: int
@@ -109,8 +118,11 @@ class _CunumericSharedLib:
     CUNUMERIC_RED_PROD: int
     CUNUMERIC_RED_SUM: int
     CUNUMERIC_REPEAT: int
+    CUNUMERIC_SAVE_CHUNKS: int
+    CUNUMERIC_SAVE_NPY: int
     CUNUMERIC_SCALAR_UNARY_RED: int
     CUNUMERIC_SORT: int
+    CUNUMERIC_SYEVD: int
     CUNUMERIC_SYRK: int
     CUNUMERIC_TILE: int
     CUNUMERIC_TRANSPOSE_COPY_2D: int
@@ -119,6 +131,7 @@ class _CunumericSharedLib:
     CUNUMERIC_TUNABLE_HAS_NUMAMEM: int
     CUNUMERIC_TUNABLE_MAX_EAGER_VOLUME: int
     CUNUMERIC_TUNABLE_NUM_GPUS: int
+    CUNUMERIC_TUNABLE_NUM_NODES: int
     CUNUMERIC_TUNABLE_NUM_PROCS: int
     CUNUMERIC_TYPE_POINT1: int
     CUNUMERIC_TYPE_POINT2: int
@@ -253,10 +266,12 @@ _cunumeric = cast(_CunumericSharedLib, cunumeric_lib.shared_object)
 class CuNumericOpCode(IntEnum):
     ADVANCED_INDEXING = _cunumeric.CUNUMERIC_ADVANCED_INDEXING
     ARANGE = _cunumeric.CUNUMERIC_ARANGE
+    BATCHED_MATMUL = _cunumeric.CUNUMERIC_BATCHED_MATMUL
     BINARY_OP = _cunumeric.CUNUMERIC_BINARY_OP
     BINARY_RED = _cunumeric.CUNUMERIC_BINARY_RED
     BINCOUNT = _cunumeric.CUNUMERIC_BINCOUNT
     CHOOSE = _cunumeric.CUNUMERIC_CHOOSE
+    CONCATENATE = _cunumeric.CUNUMERIC_CONCATENATE
     CONTRACT = _cunumeric.CUNUMERIC_CONTRACT
     CONVERT = _cunumeric.CUNUMERIC_CONVERT
     CONVOLVE = _cunumeric.CUNUMERIC_CONVOLVE
@@ -267,7 +282,14 @@ class CuNumericOpCode(IntEnum):
     FILL = _cunumeric.CUNUMERIC_FILL
     FLIP = _cunumeric.CUNUMERIC_FLIP
     GEMM = _cunumeric.CUNUMERIC_GEMM
+    GEQRF = _cunumeric.CUNUMERIC_GEQRF
+    GESVD = _cunumeric.CUNUMERIC_GESVD
+    GETRF = _cunumeric.CUNUMERIC_GETRF
+    GETRS = _cunumeric.CUNUMERIC_GETRS
+    LOAD_CHUNKS = _cunumeric.CUNUMERIC_LOAD_CHUNKS
     LOAD_CUDALIBS = _cunumeric.CUNUMERIC_LOAD_CUDALIBS
+    LOAD_NPY = _cunumeric.CUNUMERIC_LOAD_NPY
+    LOAD_TEXT = _cunumeric.CUNUMERIC_LOAD_TEXT
     MATMUL = _cunumeric.CUNUMERIC_MATMUL
     MATVECMUL = _cunumeric.CUNUMERIC_MATVECMUL
     NONZERO = _cunumeric.CUNUMERIC_NONZERO
@@ -275,8 +297,11 @@ class CuNumericOpCode(IntEnum):
     RAND = _cunumeric.CUNUMERIC_RAND
     READ = _cunumeric.CUNUMERIC_READ
     REPEAT = _cunumeric.CUNUMERIC_REPEAT
+    SAVE_CHUNKS = _cunumeric.CUNUMERIC_SAVE_CHUNKS
+    SAVE_NPY = _cunumeric.CUNUMERIC_SAVE_NPY
     SCALAR_UNARY_RED = _cunumeric.CUNUMERIC_SCALAR_UNARY_RED
     SORT = _cunumeric.CUNUMERIC_SORT
+    SYEVD = _cunumeric.CUNUMERIC_SYEVD
     SYRK = _cunumeric.CUNUMERIC_SYRK
     TILE = _cunumeric.CUNUMERIC_TILE
     TRANSPOSE_COPY_2D = _cunumeric.CUNUMERIC_TRANSPOSE_COPY_2D
@@ -415,6 +440,13 @@ class RandGenCode(IntEnum):
     UNIFORM = 1
     NORMAL = 2
     INTEGER = 3
+    EXPONENTIAL = 4
+    LOGNORMAL = 5
+    GAMMA = 6
+    BETA = 7
+    POISSON = 8
+    BINOMIAL = 9
+    NORMAL_ZIGGURAT = 10
 
 
 # Match these to CuNumericRedopID in cunumeric_c.h
@@ -431,6 +463,7 @@ class CuNumericTunable(IntEnum):
     NUM_PROCS = _cunumeric.CUNUMERIC_TUNABLE_NUM_PROCS
     MAX_EAGER_VOLUME = _cunumeric.CUNUMERIC_TUNABLE_MAX_EAGER_VOLUME
     HAS_NUMAMEM = _cunumeric.CUNUMERIC_TUNABLE_HAS_NUMAMEM
+    NUM_NODES = _cunumeric.CUNUMERIC_TUNABLE_NUM_NODES
 
 
 # Match these to fftType in fft_util.h
@@ -14,6 +14,7 @@
 #
 from __future__ import annotations
 
+import os
 import weakref
 from collections import Counter
 from collections.abc import Iterable
@@ -25,7 +26,7 @@ from typing import TYPE_CHECKING, Any
 import numpy as np
 
 import legate.core.types as ty
-from legate.core import Future, ReductionOp, Store
+from legate.core import Future, Rect, ReductionOp, Store
 
 from .config import (
     BinaryOpCode,
@@ -35,7 +36,13 @@ from .config import (
     UnaryOpCode,
     UnaryRedCode,
 )
+from .linalg.batched_matmul import batched_matmul
 from .linalg.cholesky import cholesky
+from .linalg.eigh import eigh
+from .linalg.qr import qr
+from .linalg.solve import solve
+from .linalg.summa import summa, use_summa
+from .linalg.svd import svd
 from .sort import sort
 from .thunk import NumPyThunk
 from .utils import get_arg_value_dtype, is_advanced_indexing
@@ -160,6 +167,7 @@ class BlasOperation(IntEnum):
     VV = 1
     MV = 2
     MM = 3
+    BATCHED_MM = 4
 
 
 class DeferredArray(NumPyThunk):
@@ -793,25 +801,50 @@ class DeferredArray(NumPyThunk):
 
     def reshape(self, newshape, order) -> DeferredArray:
         assert isinstance(newshape, Iterable)
+        newshape = tuple(newshape)
         if order == "A":
             order = "C"
 
-        if order != "C":
-            # If we don't have a transform then we need to make a copy
-            self.runtime.warn(
-                "cuNumeric has not implemented reshape using Fortran-like "
-                "index order and is falling back to canonical numpy. You may "
-                "notice significantly decreased performance for this "
-                "function call.",
-                category=RuntimeWarning,
+        if order == "F" and (self.ndim > 1 or len(newshape) > 1):
+            # Reshaping in Fortran order is reshaping the transpose in C
+            # order, and transposes are views
+            src = self._reverse_axes()
+            return src.reshape(tuple(reversed(newshape)), "C")._reverse_axes()
+
+        if self.shape == newshape:
+            return self
+
+        if self.size == 0:
+            return self.runtime.create_empty_thunk(
+                newshape, dtype=self.dtype, inputs=[self]
             )
-            numpy_array = self.__numpy_array__()
-            # Force a copy here because we know we can't build a view
-            result_array = numpy_array.reshape(newshape, order=order).copy()
-            result = self.runtime.get_numpy_thunk(result_array)
 
+        # Extents of 1 are dropped from the source by projections and added
+        # to the target by promotions, neither of which copies, so that only
+        # the other extents decide whether the data needs to be copied
+        src = self.base
+        for dim in reversed(range(self.ndim)):
+            if self.shape[dim] == 1:
+                src = src.project(dim, 0)
+        squeezed_shape = tuple(extent for extent in newshape if extent != 1)
+        result = DeferredArray(self.runtime, src, self.dtype)._reshape(
+            squeezed_shape
+        )
+        if len(squeezed_shape) == len(newshape):
             return result
 
+        tgt = result.base
+        for dim, extent in enumerate(newshape):
+            if extent == 1:
+                tgt = tgt.promote(dim, 1)
+        return DeferredArray(self.runtime, tgt, self.dtype)
+
+    def _reverse_axes(self) -> DeferredArray:
+        if self.ndim < 2:
+            return self
+        return self.transpose(tuple(reversed(range(self.ndim))))
+
+    def _reshape(self, newshape) -> DeferredArray:
         if self.shape == newshape:
             return self
 
@@ -1150,6 +1183,18 @@ class DeferredArray(NumPyThunk):
         )
         self._fill(store)
 
+    # The tasks that write whole matrices in place need their outputs in C
+    # order, which the store of a view of another array may not be in. Such
+    # views get a zeroed temporary to be copied back instead.
+    def _c_order_output(self):
+        if not self.base.transformed:
+            return self
+        out = self.runtime.create_empty_thunk(
+            self.shape, self.dtype, inputs=[self]
+        )
+        out.fill(np.array(0, dtype=self.dtype))
+        return out
+
     @auto_convert([2, 4])
     def contract(
         self,
@@ -1167,6 +1212,9 @@ class DeferredArray(NumPyThunk):
             np.complex64,
             np.complex128,
         ]
+        # The matrix-vector and matrix-matrix tasks also take int8 operands,
+        # which have no general-purpose contraction
+        blas_dtypes = supported_dtypes + [np.int8]
         lhs_thunk = self
 
         # Sanity checks
@@ -1194,9 +1242,12 @@ class DeferredArray(NumPyThunk):
                 lhs_thunk.shape + rhs1_thunk.shape + rhs2_thunk.shape,
             )
         )
-        # casting has been handled by the frontend
-        assert lhs_thunk.dtype == rhs1_thunk.dtype
-        assert lhs_thunk.dtype == rhs2_thunk.dtype
+        # casting has been handled by the frontend, which leaves int8
+        # operands of an int32 result as they are
+        assert rhs1_thunk.dtype == rhs2_thunk.dtype
+        assert lhs_thunk.dtype == rhs1_thunk.dtype or (
+            lhs_thunk.dtype == np.int32 and rhs1_thunk.dtype == np.int8
+        )
 
         # Handle store overlap
         rhs1_thunk = rhs1_thunk._copy_if_overlapping(lhs_thunk)
@@ -1204,7 +1255,17 @@ class DeferredArray(NumPyThunk):
 
         # Test for special cases where we can use BLAS
         blas_op = None
-        if any(c != 2 for c in mode_counts.values()):
+        if (
+            lhs_thunk.dtype in supported_dtypes
+            and len(lhs_modes) == 3
+            and len(rhs1_modes) == 3
+            and len(rhs2_modes) == 3
+            and lhs_modes[0] == rhs1_modes[0] == rhs2_modes[0]
+            and sum(c == 3 for c in mode_counts.values()) == 1
+        ):
+            # Stacked matrix products with the batch as the leading mode
+            blas_op = BlasOperation.BATCHED_MM
+        elif any(c != 2 for c in mode_counts.values()):
             pass
         elif (
             len(lhs_modes) == 0
@@ -1214,7 +1275,7 @@ class DeferredArray(NumPyThunk):
             # this case works for any arithmetic type, not just floats
             blas_op = BlasOperation.VV
         elif (
-            lhs_thunk.dtype in supported_dtypes
+            rhs1_thunk.dtype in blas_dtypes
             and len(lhs_modes) == 1
             and (
                 len(rhs1_modes) == 2
@@ -1225,7 +1286,7 @@ class DeferredArray(NumPyThunk):
         ):
             blas_op = BlasOperation.MV
         elif (
-            lhs_thunk.dtype in supported_dtypes
+            rhs1_thunk.dtype in blas_dtypes
             and len(lhs_modes) == 2
             and len(rhs1_modes) == 2
             and len(rhs2_modes) == 2
@@ -1241,6 +1302,31 @@ class DeferredArray(NumPyThunk):
             lhs_thunk = self.runtime.create_empty_thunk(
                 lhs_thunk.shape, np.dtype(np.float32), inputs=[lhs_thunk]
             )
+        # Likewise, the int8 tasks accumulate in int32. Integer arithmetic
+        # wraps around, so casting the result back gives the same values
+        # as accumulating in int8 directly.
+        elif (
+            blas_op in (BlasOperation.MV, BlasOperation.MM)
+            and lhs_thunk.dtype == np.int8
+        ):
+            lhs_thunk = self.runtime.create_empty_thunk(
+                lhs_thunk.shape, np.dtype(np.int32), inputs=[lhs_thunk]
+            )
+        # Only the matrix tasks multiply int8 operands into an int32 result,
+        # so the other contractions get widened operands
+        if self.dtype != rhs1_thunk.dtype and blas_op not in (
+            BlasOperation.MV,
+            BlasOperation.MM,
+        ):
+            widened = []
+            for thunk in (rhs1_thunk, rhs2_thunk):
+                widened.append(
+                    self.runtime.create_empty_thunk(
+                        thunk.shape, self.dtype, inputs=[thunk]
+                    )
+                )
+                widened[-1].convert(thunk, warn=False)
+            rhs1_thunk, rhs2_thunk = widened
 
         # Clear output array
         lhs_thunk.fill(np.array(0, dtype=lhs_thunk.dtype))
@@ -1318,24 +1404,55 @@ class DeferredArray(NumPyThunk):
                 assert m == rhs1.shape[0]
                 assert n == rhs2.shape[1]
                 assert k == rhs2.shape[0]
-                lhs = lhs.promote(1, k)
-                rhs1 = rhs1.promote(2, n)
-                rhs2 = rhs2.promote(0, m)
 
-                task = self.context.create_task(CuNumericOpCode.MATMUL)
-                task.add_reduction(lhs, ReductionOp.ADD)
-                task.add_input(rhs1)
-                task.add_input(rhs2)
-                task.add_alignment(lhs, rhs1)
-                task.add_alignment(lhs, rhs2)
-                task.execute()
+                if use_summa(self.runtime, m, n, k):
+                    out = lhs_thunk._c_order_output()
+                    summa(self.runtime, out.base, rhs1, rhs2)
+                    if out is not lhs_thunk:
+                        lhs_thunk.copy(out)
+                else:
+                    lhs = lhs.promote(1, k)
+                    rhs1 = rhs1.promote(2, n)
+                    rhs2 = rhs2.promote(0, m)
+
+                    task = self.context.create_task(CuNumericOpCode.MATMUL)
+                    task.add_reduction(lhs, ReductionOp.ADD)
+                    task.add_input(rhs1)
+                    task.add_input(rhs2)
+                    task.add_alignment(lhs, rhs1)
+                    task.add_alignment(lhs, rhs2)
+                    task.execute()
+
+            elif blas_op == BlasOperation.BATCHED_MM:
+                # Batched matrix-matrix multiply, normalized in the same way
+                # as the matrix-matrix case, ignoring the batch mode
+                if lhs_modes[1] not in rhs1_modes:
+                    rhs1, rhs2 = rhs2, rhs1
+                    rhs1_modes, rhs2_modes = rhs2_modes, rhs1_modes
+                if lhs_modes[1] != rhs1_modes[1]:
+                    rhs1 = rhs1.transpose([0, 2, 1])
+                    rhs1_modes = [rhs1_modes[0], rhs1_modes[2], rhs1_modes[1]]
+                if lhs_modes[2] != rhs2_modes[2]:
+                    rhs2 = rhs2.transpose([0, 2, 1])
+                    rhs2_modes = [rhs2_modes[0], rhs2_modes[2], rhs2_modes[1]]
+
+                # Products with an empty mode are all zeros, which the
+                # output already is
+                if all(
+                    thunk.size > 0
+                    for thunk in (lhs_thunk, rhs1_thunk, rhs2_thunk)
+                ):
+                    out = lhs_thunk._c_order_output()
+                    batched_matmul(self.runtime, out.base, rhs1, rhs2)
+                    if out is not lhs_thunk:
+                        lhs_thunk.copy(out)
 
             else:
                 assert False
 
-            # If we used a single-precision intermediate accumulator, cast the
-            # result back to half-precision.
-            if rhs1_thunk.dtype == np.float16:
+            # If we used a wider intermediate accumulator, cast the result
+            # back to the original type.
+            if lhs_thunk is not self:
                 self.convert(
                     lhs_thunk,
                     warn=False,
@@ -1604,6 +1721,21 @@ class DeferredArray(NumPyThunk):
 
         task.execute()
 
+    # Copy the inputs into this array at the given offsets along the axis.
+    # Each point task fills its tile of the output from the inputs that
+    # overlap it, so all inputs are broadcast.
+    def concatenate(self, inputs, axis, offsets):
+        task = self.context.create_task(CuNumericOpCode.CONCATENATE)
+        task.add_output(self.base)
+        for input in inputs:
+            input = self.runtime.to_deferred_array(input).base
+            task.add_input(input)
+            task.add_broadcast(input)
+        task.add_scalar_arg(axis, ty.int32)
+        task.add_scalar_arg(offsets, (ty.int64,))
+
+        task.execute()
+
     # Perform a bin count operation on the array
     @auto_convert([1], ["weights"])
     def bincount(self, rhs, weights=None):
@@ -1653,32 +1785,38 @@ class DeferredArray(NumPyThunk):
         task.execute()
         return results
 
-    def random(self, gen_code, args=[]) -> None:
+    def random(self, gen_code, args=[], key=None, counter=0) -> None:
         task = self.context.create_task(CuNumericOpCode.RAND)
 
         task.add_output(self.base)
         task.add_scalar_arg(gen_code.value, ty.int32)
-        epoch = self.runtime.get_next_random_epoch()
-        task.add_scalar_arg(epoch, ty.uint32)
+        if key is None:
+            key = (self.runtime.get_next_random_epoch(), 0)
+        task.add_scalar_arg(key[0], ty.uint32)
+        task.add_scalar_arg(key[1], ty.uint32)
+        task.add_scalar_arg(counter, ty.uint64)
         task.add_scalar_arg(self.compute_strides(self.shape), (ty.int64,))
         self.add_arguments(task, args)
 
         task.execute()
 
     def random_uniform(self) -> None:
-        assert self.dtype == np.float64
+        assert self.dtype in (np.float16, np.float32, np.float64)
         self.random(RandGenCode.UNIFORM)
 
     def random_normal(self) -> None:
-        assert self.dtype == np.float64
+        assert self.dtype in (np.float16, np.float32, np.float64)
         self.random(RandGenCode.NORMAL)
 
     def random_integer(self, low, high) -> None:
         assert self.dtype.kind == "i"
-        low = np.array(low, self.dtype)
-        high = np.array(high, self.dtype)
+        low = np.array(low, np.int64)
+        high = np.array(high, np.int64)
         self.random(RandGenCode.INTEGER, [low, high])
 
+    def random_distribution(self, gen_code, key, counter, args) -> None:
+        self.random(gen_code, args, key, counter)
+
     # Perform the unary operation and put the result in the array
     @auto_convert([2])
     def unary_op(self, op, src, where, args, multiout=None):
@@ -1904,6 +2042,22 @@ class DeferredArray(NumPyThunk):
     def cholesky(self, src, no_tril=False):
         cholesky(self, src, no_tril)
 
+    @auto_convert([1, 2])
+    def solve(self, a, b):
+        solve(self, a, b)
+
+    @auto_convert([1], ["q", "b"])
+    def qr(self, a, q=None, b=None):
+        qr(self, a, q, b)
+
+    @auto_convert([1], ["v"])
+    def eigh(self, a, v=None, lower=True):
+        eigh(self, a, v, lower)
+
+    @auto_convert([1], ["u", "vh"])
+    def svd(self, a, u=None, vh=None, full_matrices=False):
+        svd(self, a, u, vh, full_matrices)
+
     def unique(self):
         result = self.runtime.create_unbound_thunk(self.dtype)
 
@@ -1972,3 +2126,120 @@ class DeferredArray(NumPyThunk):
         for arg in args:
             task.add_scalar_arg(arg, ty.float64)
         task.execute()
+
+    def _add_npy_arguments(self, task, store, path, offset) -> None:
+        task.throws_exception(OSError)
+        task.add_scalar_arg(tuple(os.fsencode(path)), (ty.uint8,))
+        task.add_scalar_arg(offset, ty.uint64)
+        task.add_scalar_arg(self.compute_strides(store.shape), (ty.int64,))
+        # Tiles that span all but the first dimension are a single run of
+        # the file, so each point task makes one large read or write
+        if store.ndim > 1 and store.shape[0] >= self.runtime.num_procs:
+            task.add_broadcast(store, axes=tuple(range(1, store.ndim)))
+
+    def load_npy(self, path, offset, fortran_order) -> None:
+        store = self.base
+        if fortran_order:
+            # The file holds the transpose of the array in row-major order
+            store = store.transpose(tuple(reversed(range(self.ndim))))
+        task = self.context.create_task(CuNumericOpCode.LOAD_NPY)
+        task.add_output(store)
+        self._add_npy_arguments(task, store, path, offset)
+        task.execute()
+
+    def save_npy(self, path, offset) -> None:
+        task = self.context.create_task(CuNumericOpCode.SAVE_NPY)
+        task.add_input(self.base)
+        self._add_npy_arguments(task, self.base, path, offset)
+        task.execute()
+        # The runtime doesn't track the file, so wait for the writes before
+        # anything else can read it
+        self.runtime.legate_runtime.issue_execution_fence(block=True)
+
+    def _create_chunks_task(self, op_code, path, chunks, level, shuffle):
+        # Each point task gets a tile made of whole chunks, so that no chunk
+        # is shared between tasks. The prime factors of the processor count
+        # go to the dimensions with the most chunks per tile.
+        grid = [(e + c - 1) // c for e, c in zip(self.shape, chunks)]
+        factors = []
+        remaining = self.runtime.num_procs
+        factor = 2
+        while remaining > 1:
+            while remaining % factor == 0:
+                factors.append(factor)
+                remaining //= factor
+            factor += 1
+        colors = [1] * self.ndim
+        for factor in reversed(factors):
+            dim = max(range(self.ndim), key=lambda d: grid[d] / colors[d])
+            colors[dim] = min(colors[dim] * factor, grid[dim])
+        tile_shape = tuple(
+            c * ((g + n - 1) // n) for c, g, n in zip(chunks, grid, colors)
+        )
+        color_shape = tuple(
+            (e + t - 1) // t for e, t in zip(self.shape, tile_shape)
+        )
+
+        task = self.context.create_manual_task(
+            op_code, launch_domain=Rect(hi=color_shape)
+        )
+        partition = self.base.partition_by_tiling(tile_shape)
+        if op_code == CuNumericOpCode.LOAD_CHUNKS:
+            task.add_output(partition)
+        else:
+            task.add_input(partition)
+        task.throws_exception(OSError)
+        task.add_scalar_arg(tuple(os.fsencode(path)), (ty.uint8,))
+        task.add_scalar_arg(tuple(chunks), (ty.int64,))
+        task.add_scalar_arg(level, ty.int32)
+        task.add_scalar_arg(shuffle, bool)
+        return task
+
+    def load_chunks(self, path, chunks, level, shuffle) -> None:
+        task = self._create_chunks_task(
+            CuNumericOpCode.LOAD_CHUNKS, path, chunks, level, shuffle
+        )
+        task.execute()
+
+    def load_text(
+        self,
+        path,
+        begin,
+        end,
+        delimiter,
+        comments,
+        num_columns,
+        columns,
+        strict,
+        fill,
+    ) -> None:
+        # The file is split evenly among the point tasks, each of which
+        # parses the lines that start in its split. The output is unbound, so
+        # the values of the splits are concatenated in order without a
+        # separate pass to count them.
+        num_splits = self.runtime.num_procs
+        task = self.context.create_manual_task(
+            CuNumericOpCode.LOAD_TEXT, launch_domain=Rect(hi=(num_splits,))
+        )
+        task.throws_exception(ValueError)
+        task.add_output(self.base)
+        task.add_scalar_arg(tuple(os.fsencode(path)), (ty.uint8,))
+        task.add_scalar_arg(begin, ty.uint64)
+        task.add_scalar_arg(end, ty.uint64)
+        task.add_scalar_arg(num_splits, ty.uint64)
+        task.add_scalar_arg(ord(delimiter) if delimiter else 0, ty.int8)
+        task.add_scalar_arg(tuple(comments.encode()), (ty.uint8,))
+        task.add_scalar_arg(num_columns, ty.uint64)
+        task.add_scalar_arg(tuple(columns), (ty.int32,))
+        task.add_scalar_arg(strict, bool)
+        task.add_scalar_arg(fill, ty.float64)
+        task.execute()
+
+    def save_chunks(self, path, chunks, level, shuffle) -> None:
+        task = self._create_chunks_task(
+            CuNumericOpCode.SAVE_CHUNKS, path, chunks, level, shuffle
+        )
+        task.execute()
+        # The runtime doesn't track the files, so wait for the writes before
+        # anything else can read them
+        self.runtime.legate_runtime.issue_execution_fence(block=True)
@@ -510,6 +510,17 @@ class EagerArray(NumPyThunk):
         else:
             self.array = np.flip(rhs.array, axes)
 
+    def concatenate(self, inputs, axis, offsets):
+        self.check_eager_args(*inputs)
+        if self.deferred is not None:
+            self.deferred.concatenate(inputs, axis, offsets)
+        else:
+            for input, offset in zip(inputs, offsets):
+                index = (slice(None),) * axis + (
+                    slice(offset, offset + input.shape[axis]),
+                )
+                self.array[index] = input.array
+
     def contract(
         self,
         lhs_modes,
@@ -536,6 +547,7 @@ class EagerArray(NumPyThunk):
                 rhs1_thunk.array,
                 rhs2_thunk.array,
                 out=self.array,
+                dtype=self.array.dtype,
             )
 
     def choose(self, *args, rhs):
@@ -673,6 +685,13 @@ class EagerArray(NumPyThunk):
                     low, high, size=self.array.shape, dtype=self.array.dtype
                 )
 
+    def random_distribution(self, gen_code, key, counter, args) -> None:
+        # Always generate with the counter-based generator, so that the
+        # values do not depend on whether the array is eager
+        self.to_deferred_array().random_distribution(
+            gen_code, key, counter, args
+        )
+
     def unary_op(self, op, rhs, where, args, multiout=None):
         if multiout is None:
             self.check_eager_args(rhs, where)
@@ -838,6 +857,67 @@ class EagerArray(NumPyThunk):
                 result = np.triu(result.T.conj(), k=1) + result
             self.array[:] = result
 
+    def solve(self, a, b):
+        self.check_eager_args(a, b)
+        if self.deferred is not None:
+            self.deferred.solve(a, b)
+        else:
+            try:
+                result = np.linalg.solve(a.array, b.array)
+            except np.linalg.LinAlgError as e:
+                from .linalg import LinAlgError
+
+                raise LinAlgError(e) from e
+            self.array[:] = result
+
+    def qr(self, a, q=None, b=None):
+        self.check_eager_args(a, q, b)
+        if self.deferred is not None:
+            self.deferred.qr(a, q=q, b=b)
+        else:
+            if b is not None:
+                augmented = np.concatenate((a.array, b.array), axis=1)
+                self.array[:] = np.linalg.qr(augmented, mode="r")
+            elif q is None:
+                self.array[:] = np.linalg.qr(a.array, mode="r")
+            else:
+                q.array[:], self.array[:] = np.linalg.qr(a.array)
+
+    def eigh(self, a, v=None, lower=True):
+        self.check_eager_args(a, v)
+        if self.deferred is not None:
+            self.deferred.eigh(a, v=v, lower=lower)
+        else:
+            uplo = "L" if lower else "U"
+            try:
+                if v is None:
+                    self.array[:] = np.linalg.eigvalsh(a.array, UPLO=uplo)
+                else:
+                    self.array[:], v.array[:] = np.linalg.eigh(
+                        a.array, UPLO=uplo
+                    )
+            except np.linalg.LinAlgError as e:
+                from .linalg import LinAlgError
+
+                raise LinAlgError(e) from e
+
+    def svd(self, a, u=None, vh=None, full_matrices=False):
+        self.check_eager_args(a, u, vh)
+        if self.deferred is not None:
+            self.deferred.svd(a, u=u, vh=vh, full_matrices=full_matrices)
+        else:
+            try:
+                if u is None:
+                    self.array[:] = np.linalg.svd(a.array, compute_uv=False)
+                else:
+                    u.array[:], self.array[:], vh.array[:] = np.linalg.svd(
+                        a.array, full_matrices=full_matrices
+                    )
+            except np.linalg.LinAlgError as e:
+                from .linalg import LinAlgError
+
+                raise LinAlgError(e) from e
+
     def unique(self):
         if self.deferred is not None:
             return self.deferred.unique()
@@ -850,3 +930,37 @@ class EagerArray(NumPyThunk):
         else:
             fn = _WINDOW_OPS[op_code]
             self.array[:] = fn(M, *args)
+
+    def load_npy(self, path, offset, fortran_order) -> None:
+        if self.deferred is not None:
+            self.deferred.load_npy(path, offset, fortran_order)
+        else:
+            data = np.fromfile(
+                path, dtype=self.array.dtype, count=self.size, offset=offset
+            )
+            order = "F" if fortran_order else "C"
+            self.array[...] = data.reshape(self.shape, order=order)
+
+    def save_npy(self, path, offset) -> None:
+        if self.deferred is not None:
+            self.deferred.save_npy(path, offset)
+        else:
+            with open(path, "r+b") as f:
+                f.seek(offset)
+                np.ascontiguousarray(self.array).tofile(f)
+
+    def load_chunks(self, path, chunks, level, shuffle) -> None:
+        if self.deferred is not None:
+            self.deferred.load_chunks(path, chunks, level, shuffle)
+        else:
+            from .npyio import _read_chunks
+
+            _read_chunks(self.array, path, chunks, level, shuffle)
+
+    def save_chunks(self, path, chunks, level, shuffle) -> None:
+        if self.deferred is not None:
+            self.deferred.save_chunks(path, chunks, level, shuffle)
+        else:
+            from .npyio import _write_chunks
+
+            _write_chunks(self.array, path, chunks, level, shuffle)
@@ -0,0 +1,58 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from cunumeric.config import CuNumericOpCode
+
+from legate.core import Rect
+
+if TYPE_CHECKING:
+    from legate.core.store import Store
+
+    from ..runtime import Runtime
+
+
+def batched_matmul(
+    runtime: Runtime, lhs: Store, rhs1: Store, rhs2: Store
+) -> None:
+    context = runtime.legate_context
+
+    # The stores are only split along the batch mode, so that every task
+    # gets whole matrices and doesn't need to reduce partial products
+    batch = lhs.shape[0]
+    if runtime.args.test_mode:
+        num_tiles = runtime.num_procs * 2
+    else:
+        num_tiles = runtime.num_procs
+    tile_size = (batch + num_tiles - 1) // num_tiles
+    num_tiles = (batch + tile_size - 1) // tile_size
+
+    def tile_shape(store: Store) -> tuple[int, int, int]:
+        return (tile_size, store.shape[1], store.shape[2])
+
+    p_lhs = lhs.partition_by_tiling(tile_shape(lhs))
+    p_rhs1 = rhs1.partition_by_tiling(tile_shape(rhs1))
+    p_rhs2 = rhs2.partition_by_tiling(tile_shape(rhs2))
+
+    task = context.create_manual_task(
+        CuNumericOpCode.BATCHED_MATMUL,
+        launch_domain=Rect((num_tiles, 1, 1)),
+    )
+    task.add_output(p_lhs)
+    task.add_input(p_rhs1)
+    task.add_input(p_rhs2)
+    task.execute()
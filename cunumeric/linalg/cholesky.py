@@ -14,8 +14,10 @@
 #
 from __future__ import annotations
 
-from typing import TYPE_CHECKING
+from time import perf_counter
+from typing import TYPE_CHECKING, Any
 
+import numpy as np
 from cunumeric.config import CuNumericOpCode
 
 from legate.core import Rect, types as ty
@@ -141,12 +143,108 @@ def gemm(
     task.execute()
 
 
+def update_trailing(
+    context: Context, p_output: StorePartition, i: int, lo: int, hi: int
+) -> None:
+    # Affine projections cannot describe a triangular launch domain, so
+    # the lower triangle of the trailing matrix is updated column by column
+    # to keep the tiles above the diagonal out of the launches
+    for k in range(lo, hi):
+        syrk(context, p_output, k, i)
+        gemm(context, p_output, k, i, k + 1, hi)
+
+
 MIN_CHOLESKY_TILE_SIZE = 2048
 MIN_CHOLESKY_MATRIX_SIZE = 8192
 
+# Tile sizes at which the GEMM throughput is measured. The throughput of
+# other tile sizes is interpolated from these, and assumed to saturate
+# beyond the largest one, which keeps the one-off benchmarks short.
+GEMM_BENCHMARK_TILE_SIZES = (256, 512, 1024)
+GEMM_BENCHMARK_REPEATS = 3
+
+# GEMM throughput of a single processor in flops per second, keyed by the
+# value type and the tile size. Each size is measured once per process, and
+# only with -cunumeric:benchmark-gemm, as the measurements block until all
+# pending tasks are done.
+_gemm_throughput: dict[tuple[np.dtype[Any], int], float] = {}
+
+
+def measure_gemm_throughput(
+    runtime: Runtime, dtype: np.dtype[Any], tile_size: int
+) -> float:
+    key = (dtype, tile_size)
+    if key in _gemm_throughput:
+        return _gemm_throughput[key]
 
-# TODO: We need a better cost model
-def choose_color_shape(runtime: Runtime, shape: Shape) -> Shape:
+    from ..deferred import DeferredArray
+
+    context = runtime.legate_context
+    shape = (tile_size, tile_size)
+    lhs, rhs1, rhs2 = (
+        DeferredArray(runtime, context.create_store(dtype, shape=shape), dtype)
+        for _ in range(3)
+    )
+    for array in (lhs, rhs1, rhs2):
+        array.fill(np.array(1, dtype=dtype))
+
+    def launch() -> None:
+        task = context.create_auto_task(CuNumericOpCode.GEMM)
+        task.add_output(lhs.base)
+        task.add_input(rhs1.base)
+        task.add_input(rhs2.base)
+        task.add_input(lhs.base)
+        task.add_broadcast(lhs.base)
+        task.add_broadcast(rhs1.base)
+        task.add_broadcast(rhs2.base)
+        task.execute()
+
+    # The first launch also creates the instances, so it isn't timed
+    launch()
+    runtime.legate_runtime.issue_execution_fence(block=True)
+    start = perf_counter()
+    for _ in range(GEMM_BENCHMARK_REPEATS):
+        launch()
+    runtime.legate_runtime.issue_execution_fence(block=True)
+    elapsed = max(perf_counter() - start, 1e-9)
+
+    throughput = GEMM_BENCHMARK_REPEATS * 2.0 * tile_size**3 / elapsed
+    _gemm_throughput[key] = throughput
+    return throughput
+
+
+def gemm_throughput(
+    runtime: Runtime, dtype: np.dtype[Any], tile_size: int
+) -> float:
+    sizes = GEMM_BENCHMARK_TILE_SIZES
+    if tile_size <= sizes[0]:
+        return measure_gemm_throughput(runtime, dtype, sizes[0])
+    for lo, hi in zip(sizes[:-1], sizes[1:]):
+        if tile_size <= hi:
+            t_lo = measure_gemm_throughput(runtime, dtype, lo)
+            t_hi = measure_gemm_throughput(runtime, dtype, hi)
+            return t_lo + (t_hi - t_lo) * (tile_size - lo) / (hi - lo)
+    # BLAS throughput saturates beyond the largest measured size
+    return measure_gemm_throughput(runtime, dtype, sizes[-1])
+
+
+# Estimates the time of a tiled factorization from the measured GEMM
+# throughput. The trailing updates amount to about n^3 / 6 tile GEMMs
+# spread over all processors, while each of the n steps has to factor
+# a panel, i.e., a few tile operations that can't run in parallel.
+def estimate_factorization_time(
+    runtime: Runtime, dtype: np.dtype[Any], extent: int, num_tiles: int
+) -> float:
+    tile_size = (extent + num_tiles - 1) // num_tiles
+    tile_time = 2.0 * tile_size**3 / gemm_throughput(runtime, dtype, tile_size)
+    work = num_tiles**3 / 6.0 * tile_time / runtime.num_procs
+    critical_path = num_tiles * 2.0 * tile_time
+    return max(work, critical_path)
+
+
+def choose_color_shape(
+    runtime: Runtime, shape: Shape, dtype: np.dtype[Any]
+) -> Shape:
     if runtime.args.test_mode:
         num_tiles = runtime.num_procs * 2
         return Shape((num_tiles, num_tiles))
@@ -157,15 +255,26 @@ def choose_color_shape(runtime: Runtime, shape: Shape) -> Shape:
     if runtime.num_procs == 1 or extent <= MIN_CHOLESKY_MATRIX_SIZE:
         return Shape((1, 1))
 
-    # If the matrix is big enough to warrant partitioning,
-    # pick the granularity that the tile size is greater than a threshold
-    num_tiles = runtime.num_procs
-    max_num_tiles = runtime.num_procs * 4
-    while (
-        (extent + num_tiles - 1) // num_tiles > MIN_CHOLESKY_TILE_SIZE
-        and num_tiles * 2 <= max_num_tiles
-    ):
-        num_tiles *= 2
+    candidates = [runtime.num_procs * scale for scale in (1, 2, 4)]
+    if not runtime.args.benchmark_gemm:
+        # Pick the finest granularity whose tiles are still larger than a
+        # threshold
+        num_tiles = candidates[0]
+        while (
+            (extent + num_tiles - 1) // num_tiles > MIN_CHOLESKY_TILE_SIZE
+            and num_tiles * 2 <= candidates[-1]
+        ):
+            num_tiles *= 2
+        return Shape((num_tiles, num_tiles))
+
+    # Otherwise, pick the granularity with the best estimated time. Finer
+    # tiles expose more parallelism, but run at a lower BLAS throughput.
+    num_tiles = min(
+        candidates,
+        key=lambda num_tiles: estimate_factorization_time(
+            runtime, dtype, extent, num_tiles
+        ),
+    )
 
     return Shape((num_tiles, num_tiles))
 
@@ -213,7 +322,7 @@ def cholesky(
         return
 
     shape = output.base.shape
-    initial_color_shape = choose_color_shape(runtime, shape)
+    initial_color_shape = choose_color_shape(runtime, shape, output.dtype)
     tile_shape = (shape + initial_color_shape - 1) // initial_color_shape
     color_shape = (shape + tile_shape - 1) // tile_shape
     n = color_shape[0]
@@ -225,9 +334,7 @@ def cholesky(
     for i in range(n):
         potrf(context, p_output, i)
         trsm(context, p_output, i, i + 1, n)
-        for k in range(i + 1, n):
-            syrk(context, p_output, k, i)
-            gemm(context, p_output, k, i, k + 1, n)
+        update_trailing(context, p_output, i, i + 1, n)
 
     if no_tril:
         return
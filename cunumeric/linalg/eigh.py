@@ -0,0 +1,50 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Optional
+
+from cunumeric.config import CuNumericOpCode
+
+from .exception import LinAlgError
+
+if TYPE_CHECKING:
+    from legate.core.context import Context
+    from legate.core.store import Store
+
+    from ..deferred import DeferredArray
+
+
+def syevd(
+    context: Context, a: Store, w: Store, v: Optional[Store], lower: bool
+) -> None:
+    task = context.create_auto_task(CuNumericOpCode.SYEVD)
+    task.throws_exception(LinAlgError)
+    task.add_input(a)
+    task.add_output(w)
+    task.add_broadcast(a)
+    task.add_broadcast(w)
+    if v is not None:
+        task.add_output(v)
+        task.add_broadcast(v)
+    task.add_scalar_arg(lower, bool)
+    task.execute()
+
+
+# TODO: The eigensolver only runs on a single processor for now
+def eigh(
+    w: DeferredArray, a: DeferredArray, v: Optional[DeferredArray], lower: bool
+) -> None:
+    syevd(w.context, a.base, w.base, None if v is None else v.base, lower)
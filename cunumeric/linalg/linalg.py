@@ -14,12 +14,21 @@
 #
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Sequence, Union
+from typing import TYPE_CHECKING, Any, Optional, Sequence, Union
 
 import numpy as np
 from cunumeric._ufunc.math import add, sqrt as _sqrt
 from cunumeric.array import add_boilerplate, convert_to_cunumeric_ndarray
-from cunumeric.module import dot, empty_like, eye, matmul, ndarray
+from cunumeric.linalg.exception import LinAlgError
+from cunumeric.module import (
+    array,
+    dot,
+    empty,
+    empty_like,
+    eye,
+    matmul,
+    ndarray,
+)
 from numpy.core.multiarray import normalize_axis_index  # type: ignore
 from numpy.core.numeric import normalize_axis_tuple  # type: ignore
 
@@ -80,6 +89,488 @@ def cholesky(a: ndarray) -> ndarray:
     return _cholesky(a)
 
 
+@add_boilerplate("a")
+def eigh(a: ndarray, UPLO: str = "L") -> tuple[ndarray, ndarray]:
+    """
+    Return the eigenvalues and eigenvectors of a complex Hermitian
+    (conjugate symmetric) or a real symmetric matrix.
+
+    Returns two objects, a 1-D array containing the eigenvalues of `a`, and
+    a 2-D square array or matrix (depending on the input type) of the
+    corresponding eigenvectors (in columns).
+
+    Parameters
+    ----------
+    a : (M, M) array_like
+        Hermitian or real symmetric matrix whose eigenvalues and
+        eigenvectors are to be computed.
+    UPLO : ``{'L', 'U'}``, optional
+        Specifies whether the calculation is done with the lower triangular
+        part of `a` ('L', default) or the upper triangular part ('U').
+        Irrespective of this value only the real parts of the diagonal will
+        be considered in the computation to preserve the notion of a
+        Hermitian matrix.
+
+    Returns
+    -------
+    w : (M,) ndarray
+        The eigenvalues in ascending order, each repeated according to
+        its multiplicity.
+    v : (M, M) ndarray
+        The column ``v[:, i]`` is the normalized eigenvector corresponding
+        to the eigenvalue ``w[i]``.
+
+    Raises
+    ------
+    LinAlgError
+        If the eigenvalue computation does not converge.
+
+    Notes
+    -----
+    The decomposition is computed on a single processor.
+
+    See Also
+    --------
+    numpy.linalg.eigh
+
+    Availability
+    --------
+    Single GPU, Single CPU
+    """
+    v, w = _eigh(a, UPLO, compute_v=True)
+    assert v is not None
+    return w, v
+
+
+@add_boilerplate("a")
+def eigvalsh(a: ndarray, UPLO: str = "L") -> ndarray:
+    """
+    Compute the eigenvalues of a complex Hermitian or real symmetric matrix.
+
+    Parameters
+    ----------
+    a : (M, M) array_like
+        A complex- or real-valued matrix whose eigenvalues are to be
+        computed.
+    UPLO : ``{'L', 'U'}``, optional
+        Specifies whether the calculation is done with the lower triangular
+        part of `a` ('L', default) or the upper triangular part ('U').
+
+    Returns
+    -------
+    w : (M,) ndarray
+        The eigenvalues in ascending order, each repeated according to
+        its multiplicity.
+
+    Raises
+    ------
+    LinAlgError
+        If the eigenvalue computation does not converge.
+
+    See Also
+    --------
+    numpy.linalg.eigvalsh
+
+    Availability
+    --------
+    Single GPU, Single CPU
+    """
+    _, w = _eigh(a, UPLO, compute_v=False)
+    return w
+
+
+@add_boilerplate("a")
+def svd(
+    a: ndarray,
+    full_matrices: bool = True,
+    compute_uv: bool = True,
+    hermitian: bool = False,
+) -> Any:
+    """
+    Singular Value Decomposition.
+
+    When `a` is a 2D array, it is factorized as ``u @ np.diag(s) @ vh
+    = (u * s) @ vh``, where `u` and `vh` are 2D unitary arrays and `s` is a
+    1D array of `a`'s singular values.
+
+    Parameters
+    ----------
+    a : (M, N) array_like
+        A real or complex array.
+    full_matrices : bool, optional
+        If True (default), `u` and `vh` have the shapes ``(M, M)`` and
+        ``(N, N)``, respectively.  Otherwise, the shapes are ``(M, K)`` and
+        ``(K, N)``, respectively, where ``K = min(M, N)``.
+    compute_uv : bool, optional
+        Whether or not to compute `u` and `vh` in addition to `s`.  True
+        by default.
+    hermitian : bool, optional
+        Accepted for compatibility with NumPy and ignored.
+
+    Returns
+    -------
+    u : ndarray
+        Unitary array. Only returned when `compute_uv` is True.
+    s : (K,) ndarray
+        The singular values, sorted in descending order.
+    vh : ndarray
+        Unitary array. Only returned when `compute_uv` is True.
+
+    Raises
+    ------
+    LinAlgError
+        If SVD computation does not converge.
+
+    Notes
+    -----
+    Tall matrices are first reduced with a distributed tall-skinny QR, so
+    that only the SVD of the small triangular factor runs on a single
+    processor. Wide matrices are handled through their conjugate transpose.
+    With `full_matrices` set, the whole decomposition runs on a single
+    processor.
+
+    See Also
+    --------
+    numpy.linalg.svd
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.ndim > 2:
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+
+    m, n = a.shape
+    if m < n:
+        # The decomposition of a wide matrix is the conjugate transpose of
+        # the decomposition of its conjugate transpose
+        u, s, vh = _svd(a.T.conj(), full_matrices, compute_uv)
+        if not compute_uv:
+            return s
+        assert u is not None and vh is not None
+        return vh.T.conj(), s, u.T.conj()
+
+    u, s, vh = _svd(a, full_matrices, compute_uv)
+    if not compute_uv:
+        return s
+    return u, s, vh
+
+
+@add_boilerplate("a", "b")
+def solve(a: ndarray, b: ndarray) -> ndarray:
+    """
+    Solve a linear matrix equation, or system of linear scalar equations.
+
+    Computes the "exact" solution, `x`, of the well-determined, i.e., full
+    rank, linear matrix equation `ax = b`.
+
+    Parameters
+    ----------
+    a : (M, M) array_like
+        Coefficient matrix.
+    b : {(M,), (M, K)}, array_like
+        Ordinate or "dependent variable" values.
+
+    Returns
+    -------
+    x : {(M,), (M, K)} ndarray
+        Solution to the system a x = b.  Returned shape is identical to `b`.
+
+    Raises
+    ------
+    LinAlgError
+        If `a` is singular or not square.
+
+    Notes
+    -----
+    The solution is computed with an LU factorization with partial
+    pivoting, which is tiled across processors for large matrices.
+
+    See Also
+    --------
+    numpy.linalg.solve
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.shape[-1] != a.shape[-2]:
+        raise LinAlgError("Last 2 dimensions of the array must be square")
+    if a.ndim > 2:
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+    if b.ndim not in (1, 2):
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+    if b.shape[0] != a.shape[0]:
+        raise ValueError(
+            f"solve: Input operand 1 has a mismatch in its core dimension 0 "
+            f"(size {b.shape[0]} is different from {a.shape[0]})"
+        )
+
+    if b.ndim == 1:
+        return _solve(a, b.reshape((b.shape[0], 1))).reshape(b.shape)
+    return _solve(a, b)
+
+
+@add_boilerplate("a")
+def inv(a: ndarray) -> ndarray:
+    """
+    Compute the (multiplicative) inverse of a matrix.
+
+    Given a square matrix `a`, return the matrix `ainv` satisfying
+    ``dot(a, ainv) = dot(ainv, a) = eye(a.shape[0])``.
+
+    Parameters
+    ----------
+    a : (M, M) array_like
+        Matrix to be inverted.
+
+    Returns
+    -------
+    ainv : (M, M) ndarray
+        (Multiplicative) inverse of the matrix `a`.
+
+    Raises
+    ------
+    LinAlgError
+        If `a` is not square or inversion fails.
+
+    See Also
+    --------
+    numpy.linalg.inv
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.shape[-1] != a.shape[-2]:
+        raise LinAlgError("Last 2 dimensions of the array must be square")
+    if a.ndim > 2:
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+    return _solve(a, eye(a.shape[0], dtype=_linalg_dtype(a.dtype)))
+
+
+@add_boilerplate("a")
+def qr(a: ndarray, mode: str = "reduced") -> Any:
+    """
+    Compute the qr factorization of a matrix.
+
+    Factor the matrix `a` as *qr*, where `q` is orthonormal and `r` is
+    upper-triangular.
+
+    Parameters
+    ----------
+    a : array_like, shape (M, N)
+        An array-like object with the dimensionality of at least 2.
+    mode : ``{'reduced', 'complete', 'r'}``, optional
+        If K = min(M, N), then
+
+        * 'reduced'  : returns q, r with dimensions (M, K), (K, N) (default)
+        * 'complete' : returns q, r with dimensions (M, M), (M, N)
+        * 'r'        : returns r only with dimensions (K, N)
+
+    Returns
+    -------
+    q : ndarray of float or complex, optional
+        A matrix with orthonormal columns. Not returned for mode 'r'.
+    r : ndarray of float or complex, optional
+        The upper-triangular matrix.
+
+    Notes
+    -----
+    Tall matrices are factored with a tall-skinny QR: the row blocks are
+    factored independently and their R factors are then reduced with one
+    more QR factorization. The 'complete' mode is only supported when
+    M <= N, and the 'raw' mode is not supported.
+
+    See Also
+    --------
+    numpy.linalg.qr
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.ndim > 2:
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+    if mode not in ("reduced", "complete", "r", "raw"):
+        raise ValueError(f"Unrecognized mode '{mode}'")
+    if mode == "raw":
+        raise NotImplementedError("cuNumeric does not support mode 'raw'")
+    if mode == "complete" and a.shape[0] > a.shape[1]:
+        raise NotImplementedError(
+            "cuNumeric does not support mode 'complete' for tall matrices"
+        )
+
+    q, r = _qr(a, compute_q=mode != "r")
+    if q is None:
+        return r
+    return q, r
+
+
+@add_boilerplate("a", "b")
+def lstsq(a: ndarray, b: ndarray, rcond: Union[float, None] = None) -> Any:
+    """
+    Return the least-squares solution to a linear matrix equation.
+
+    Computes the vector `x` that approximately solves the equation
+    ``a @ x = b``. The equation may be under-, well-, or over-determined
+    (i.e., the number of linearly independent rows of `a` can be less than,
+    equal to, or greater than its number of linearly independent columns).
+    If `a` is square and of full rank, then `x` (but for round-off error)
+    is the "exact" solution of the equation. Else, `x` minimizes the
+    Euclidean 2-norm :math:`||b - ax||`. If there are multiple minimizing
+    solutions, the one with the smallest 2-norm :math:`||x||` is returned.
+
+    Parameters
+    ----------
+    a : (M, N) array_like
+        "Coefficient" matrix.
+    b : {(M,), (M, K)} array_like
+        Ordinate or "dependent variable" values. If `b` is two-dimensional,
+        the least-squares solution is calculated for each of the `K` columns
+        of `b`.
+    rcond : float, optional
+        Cut-off ratio for small singular values of `a`. For the purposes of
+        rank determination, singular values are treated as zero if they are
+        smaller than `rcond` times the largest singular value of `a`. The
+        default uses the machine precision times ``max(M, N)``.
+
+    Returns
+    -------
+    x : {(N,), (N, K)} ndarray
+        Least-squares solution. If `b` is two-dimensional, the solutions are
+        in the `K` columns of `x`.
+    residuals : {(1,), (K,), (0,)} ndarray
+        Sums of squared residuals: Squared Euclidean 2-norm for each column
+        in ``b - a @ x``. If the rank of `a` is < N or M <= N, this is an
+        empty array. If `b` is 1-dimensional, this is a (1,) shape array.
+        Otherwise the shape is (K,).
+    rank : int
+        Rank of matrix `a`.
+    s : (min(M, N),) ndarray
+        Singular values of `a`.
+
+    Notes
+    -----
+    The matrix is first reduced with a tall-skinny QR factorization, which
+    is distributed over the rows (or the columns, if M < N) of `a`. For a
+    tall `a`, the factorization is applied to ``[a | b]``, which yields
+    ``q^H @ b`` without forming `q`, and the R factors of the row blocks are
+    combined with a reduction tree. The remaining min(M, N) x min(M, N)
+    problem is solved on a single processor, so this is intended for
+    tall-skinny or short-wide matrices.
+
+    See Also
+    --------
+    numpy.linalg.lstsq
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if a.ndim != 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be two-dimensional"
+        )
+    if b.ndim not in (1, 2):
+        raise LinAlgError(
+            f"{b.ndim}-dimensional array given. "
+            "Array must be one or two-dimensional"
+        )
+    m, n = a.shape
+    if b.shape[0] != m:
+        raise LinAlgError("Incompatible dimensions")
+
+    dtype = _linalg_dtype(a.dtype, b.dtype)
+    if a.dtype != dtype:
+        a = a.astype(dtype)
+    if b.dtype != dtype:
+        b = b.astype(dtype)
+    b2 = b.reshape((m, 1)) if b.ndim == 1 else b
+    if rcond is None:
+        rcond = np.finfo(dtype).eps * max(m, n)
+
+    k = b2.shape[1]
+    if m >= n + k:
+        # The R factor of [a | b] is [[r, c], [0, d]] with a = q @ r and
+        # c = q^H @ b, so minimizing ||a @ x - b|| is the same as minimizing
+        # ||r @ x - c||, and the residuals are the squared column norms of d
+        _, r_aug = _qr(a, compute_q=False, b=b2)
+        r_np = r_aug.__array__()
+        x_np, _, rank, s = np.linalg.lstsq(
+            r_np[:n, :n], r_np[:n, n:], rcond=rcond
+        )
+        x = array(x_np)
+        if rank == n and m > n:
+            residuals = array((abs(r_np[n:, n:]) ** 2).sum(axis=0))
+        else:
+            residuals = empty((0,), dtype=s.dtype)
+        if b.ndim == 1:
+            x = x.reshape((n,))
+        return x, residuals, int(rank), array(s)
+
+    if m >= n:
+        # With a = q @ r, minimizing ||a @ x - b|| is the same as
+        # minimizing ||r @ x - q^H @ b||. There are more right-hand sides
+        # than rows to spare, so the augmented matrix would be wide.
+        q, r = _qr(a, compute_q=True)
+        assert q is not None
+        c = matmul(q.T.conj(), b2)
+        x_np, _, rank, s = np.linalg.lstsq(
+            r.__array__(), c.__array__(), rcond=rcond
+        )
+        x = array(x_np)
+    else:
+        # With a^H = q @ r, the minimum norm solution is x = q @ y,
+        # where y is the minimum norm solution of r^H @ y = b
+        q, r = _qr(a.T.conj(), compute_q=True)
+        assert q is not None
+        y_np, _, rank, s = np.linalg.lstsq(
+            r.__array__().T.conj(), b2.__array__(), rcond=rcond
+        )
+        x = matmul(q, array(y_np))
+
+    if rank == n and m > n:
+        residuals = (abs(b2 - matmul(a, x)) ** 2).sum(axis=0)
+    else:
+        residuals = empty((0,), dtype=s.dtype)
+
+    if b.ndim == 1:
+        x = x.reshape((n,))
+    return x, residuals, int(rank), array(s)
+
+
 # This implementation is adapted closely from NumPy
 @add_boilerplate("a")
 def matrix_power(a: ndarray, n: int) -> ndarray:
@@ -131,10 +622,8 @@ def matrix_power(a: ndarray, n: int) -> ndarray:
 
     # Invert if necessary
     if n < 0:
-        # TODO: Add this once cunumeric.inv is implemented
-        # a = inv(a)
-        # n = abs(n)
-        raise NotImplementedError("Negative exponent in matrix_power")
+        a = inv(a)
+        n = abs(n)
 
     # Fast paths
     if n == 1:
@@ -555,3 +1044,120 @@ def _cholesky(a: ndarray, no_tril: bool = False) -> ndarray:
     )
     output._thunk.cholesky(input._thunk, no_tril=no_tril)
     return output
+
+
+def _linalg_dtype(*dtypes: np.dtype[Any]) -> np.dtype[Any]:
+    dtype = np.result_type(*dtypes)
+    if dtype.kind not in ("f", "c"):
+        return np.dtype(np.float64)
+    if dtype == np.float16:
+        return np.dtype(np.float32)
+    return dtype
+
+
+def _solve(a: ndarray, b: ndarray) -> ndarray:
+    dtype = _linalg_dtype(a.dtype, b.dtype)
+    if a.dtype != dtype:
+        a = a.astype(dtype)
+    if b.dtype != dtype:
+        b = b.astype(dtype)
+    output = ndarray(
+        shape=b.shape,
+        dtype=dtype,
+        inputs=(a, b),
+    )
+    if output.size > 0:
+        output._thunk.solve(a._thunk, b._thunk)
+    return output
+
+
+# With `b`, returns the R factor of the augmented matrix [a | b], which `b`
+# must have the dtype of.
+def _qr(
+    a: ndarray, compute_q: bool, b: Optional[ndarray] = None
+) -> tuple[Union[ndarray, None], ndarray]:
+    input = a
+    dtype = _linalg_dtype(input.dtype)
+    if input.dtype != dtype:
+        input = input.astype(dtype)
+    m, n = input.shape
+    cols = n if b is None else n + b.shape[1]
+    r = ndarray(shape=(min(m, cols), cols), dtype=dtype, inputs=(input,))
+    q = (
+        ndarray(shape=(m, min(m, n)), dtype=dtype, inputs=(input,))
+        if compute_q
+        else None
+    )
+    if input.size > 0:
+        r._thunk.qr(
+            input._thunk,
+            q=None if q is None else q._thunk,
+            b=None if b is None else b._thunk,
+        )
+    return q, r
+
+
+def _eigh(
+    a: ndarray, UPLO: str, compute_v: bool
+) -> tuple[Union[ndarray, None], ndarray]:
+    if a.ndim < 2:
+        raise LinAlgError(
+            f"{a.ndim}-dimensional array given. "
+            "Array must be at least two-dimensional"
+        )
+    if a.shape[-1] != a.shape[-2]:
+        raise LinAlgError("Last 2 dimensions of the array must be square")
+    if a.ndim > 2:
+        raise NotImplementedError(
+            "cuNumeric needs to support stacked 2d arrays"
+        )
+    if UPLO not in ("L", "U"):
+        raise ValueError("UPLO argument must be 'L' or 'U'")
+
+    input = a
+    dtype = _linalg_dtype(input.dtype)
+    if input.dtype != dtype:
+        input = input.astype(dtype)
+    n = input.shape[0]
+    w = ndarray(shape=(n,), dtype=np.finfo(dtype).dtype, inputs=(input,))
+    v = (
+        ndarray(shape=(n, n), dtype=dtype, inputs=(input,))
+        if compute_v
+        else None
+    )
+    if input.size > 0:
+        w._thunk.eigh(
+            input._thunk,
+            v=None if v is None else v._thunk,
+            lower=UPLO == "L",
+        )
+    return v, w
+
+
+def _svd(
+    a: ndarray, full_matrices: bool, compute_uv: bool
+) -> tuple[Union[ndarray, None], ndarray, Union[ndarray, None]]:
+    input = a
+    dtype = _linalg_dtype(input.dtype)
+    if input.dtype != dtype:
+        input = input.astype(dtype)
+    m, n = input.shape
+    assert m >= n
+    s = ndarray(shape=(n,), dtype=np.finfo(dtype).dtype, inputs=(input,))
+    u = vh = None
+    if compute_uv:
+        u_shape = (m, m) if full_matrices else (m, n)
+        u = ndarray(shape=u_shape, dtype=dtype, inputs=(input,))
+        vh = ndarray(shape=(n, n), dtype=dtype, inputs=(input,))
+    if input.size > 0:
+        s._thunk.svd(
+            input._thunk,
+            u=None if u is None else u._thunk,
+            vh=None if vh is None else vh._thunk,
+            full_matrices=full_matrices,
+        )
+    elif u is not None:
+        # Only the left singular vectors of a matrix without columns are
+        # non-empty, which can be any orthonormal basis
+        u[...] = eye(m, u.shape[1], dtype=dtype)
+    return u, s, vh
@@ -0,0 +1,203 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Optional
+
+from cunumeric.config import CuNumericOpCode
+
+from legate.core import Rect
+
+from .exception import LinAlgError
+
+if TYPE_CHECKING:
+    from legate.core.context import Context
+    from legate.core.store import Store, StorePartition
+
+    from ..deferred import DeferredArray
+    from ..runtime import Runtime
+
+
+def geqrf_single(
+    context: Context,
+    a: Store,
+    r: Store,
+    q: Optional[Store],
+    b: Optional[Store] = None,
+) -> None:
+    task = context.create_auto_task(CuNumericOpCode.GEQRF)
+    task.throws_exception(LinAlgError)
+    task.add_input(a)
+    task.add_broadcast(a)
+    if b is not None:
+        task.add_input(b)
+        task.add_broadcast(b)
+    task.add_output(r)
+    task.add_broadcast(r)
+    if q is not None:
+        task.add_output(q)
+        task.add_broadcast(q)
+    task.execute()
+
+
+def geqrf(
+    context: Context,
+    launch_domain: Rect,
+    p_a: StorePartition,
+    p_r: StorePartition,
+    p_q: Optional[StorePartition],
+    p_b: Optional[StorePartition] = None,
+) -> None:
+    task = context.create_manual_task(
+        CuNumericOpCode.GEQRF, launch_domain=launch_domain
+    )
+    task.throws_exception(LinAlgError)
+    task.add_input(p_a)
+    if p_b is not None:
+        task.add_input(p_b)
+    task.add_output(p_r)
+    if p_q is not None:
+        task.add_output(p_q)
+    task.execute()
+
+
+MIN_TSQR_MATRIX_ROWS = 65536
+
+# Number of R factors that each task of the TSQR reduction tree combines
+TSQR_TREE_FAN_IN = 8
+
+
+# Picks the number of rows per block for the tall-skinny QR. Every block
+# must have at least as many rows as the matrix has columns, so that the
+# R factors of the blocks are all square.
+def choose_tile_size(runtime: Runtime, m: int, n: int) -> int:
+    if runtime.args.test_mode:
+        num_blocks = runtime.num_procs * 2
+    elif runtime.num_procs == 1 or m <= MIN_TSQR_MATRIX_ROWS:
+        return m
+    else:
+        num_blocks = runtime.num_procs
+
+    while num_blocks > 1:
+        tile_size = (m + num_blocks - 1) // num_blocks
+        num_tiles = (m + tile_size - 1) // tile_size
+        if m - (num_tiles - 1) * tile_size >= n:
+            return tile_size
+        num_blocks -= 1
+    return m
+
+
+def blocks_of(array: DeferredArray, size: int) -> list[DeferredArray]:
+    from ..deferred import DeferredArray
+
+    extent = array.shape[0]
+    return [
+        DeferredArray(
+            array.runtime,
+            base=array.base.slice(0, slice(lo, min(lo + size, extent))),
+            dtype=array.dtype,
+        )
+        for lo in range(0, extent, size)
+    ]
+
+
+# Factors the R factors stacked on top of each other in `stacked` into `r`.
+# Each level of the tree factors groups of TSQR_TREE_FAN_IN of them in
+# parallel, so that no task receives more than that many factors.
+def reduce_r(r: DeferredArray, stacked: DeferredArray) -> None:
+    runtime = r.runtime
+    context = r.context
+
+    n = stacked.shape[1]
+    fan_in = 2 if runtime.args.test_mode else TSQR_TREE_FAN_IN
+    num_factors = stacked.shape[0] // n
+    while num_factors > fan_in:
+        num_blocks = (num_factors + fan_in - 1) // fan_in
+        reduced = runtime.create_empty_thunk(
+            (num_blocks * n, n), stacked.dtype, inputs=(stacked,)
+        )
+        p_stacked = stacked.base.partition_by_tiling((fan_in * n, n))
+        p_reduced = reduced.base.partition_by_tiling((n, n))
+        geqrf(context, Rect((num_blocks, 1)), p_stacked, p_reduced, None)
+        stacked = reduced
+        num_factors = num_blocks
+    geqrf_single(context, stacked.base, r.base, None)
+
+
+# Computes the R factor of `a`, and its Q factor if `q` is passed. With `b`,
+# the R factor is that of the augmented matrix [a | b], whose top right
+# block is Q^H @ b, so that least squares solvers never form Q.
+def qr(
+    r: DeferredArray,
+    a: DeferredArray,
+    q: Optional[DeferredArray],
+    b: Optional[DeferredArray] = None,
+) -> None:
+    runtime = r.runtime
+    context = r.context
+
+    assert q is None or b is None
+    m, n = a.shape
+    nrhs = 0 if b is None else b.shape[1]
+    cols = n + nrhs
+    tile_size = choose_tile_size(runtime, m, cols)
+    if tile_size >= m:
+        geqrf_single(
+            context,
+            a.base,
+            r.base,
+            None if q is None else q.base,
+            None if b is None else b.base,
+        )
+        return
+
+    # Tall-skinny QR: factor each row block independently, then factor
+    # the R factors of the blocks stacked on top of each other
+    num_blocks = (m + tile_size - 1) // tile_size
+    launch_domain = Rect((num_blocks, 1))
+
+    stacked_r = runtime.create_empty_thunk(
+        (num_blocks * cols, cols), a.dtype, inputs=(a,)
+    )
+    q1 = (
+        None
+        if q is None
+        else runtime.create_empty_thunk((m, n), a.dtype, inputs=(a,))
+    )
+
+    p_a = a.base.partition_by_tiling((tile_size, n))
+    p_b = None if b is None else b.base.partition_by_tiling((tile_size, nrhs))
+    p_r = stacked_r.base.partition_by_tiling((cols, cols))
+    p_q1 = None if q1 is None else q1.base.partition_by_tiling((tile_size, n))
+    geqrf(context, launch_domain, p_a, p_r, p_q1, p_b)
+
+    if q is None:
+        reduce_r(r, stacked_r)
+        return
+
+    # The Q factor is assembled from a single level of the tree
+    assert q1 is not None
+    q2 = runtime.create_empty_thunk((num_blocks * n, n), a.dtype, inputs=(a,))
+    geqrf_single(context, stacked_r.base, r.base, q2.base)
+
+    # The Q factor of the whole matrix is the block diagonal matrix of
+    # the blocks' Q factors times the Q factor of the stacked R factors
+    for q_blk, q1_blk, q2_blk in zip(
+        blocks_of(q, tile_size), blocks_of(q1, tile_size), blocks_of(q2, n)
+    ):
+        mode2extent = {"a": q_blk.shape[0], "b": n, "c": n}
+        q_blk.contract(
+            ["a", "c"], q1_blk, ["a", "b"], q2_blk, ["b", "c"], mode2extent
+        )
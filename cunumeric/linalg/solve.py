@@ -0,0 +1,219 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Optional
+
+from cunumeric.config import CuNumericOpCode
+
+from legate.core import Rect, types as ty
+
+from .cholesky import choose_color_shape
+from .exception import LinAlgError
+
+if TYPE_CHECKING:
+    from legate.core.context import Context
+    from legate.core.store import Store, StorePartition
+
+    from ..deferred import DeferredArray
+
+
+def getrf(context: Context, panel: Store, pivots: Store, offset: int) -> None:
+    task = context.create_auto_task(CuNumericOpCode.GETRF)
+    task.throws_exception(LinAlgError)
+    task.add_output(panel)
+    task.add_output(pivots)
+    task.add_input(panel)
+    task.add_broadcast(panel)
+    task.add_broadcast(pivots)
+    task.add_scalar_arg(offset, ty.int64)
+    task.execute()
+
+
+def getrs_single(
+    context: Context,
+    rhs: Store,
+    lu: Optional[Store],
+    pivots: Optional[Store],
+    offset: int,
+    lower: bool = False,
+    upper: bool = False,
+) -> None:
+    task = context.create_auto_task(CuNumericOpCode.GETRS)
+    task.add_output(rhs)
+    if lower or upper:
+        assert lu is not None
+        task.add_input(lu)
+        task.add_broadcast(lu)
+    if pivots is not None:
+        task.add_input(pivots)
+        task.add_broadcast(pivots)
+    task.add_input(rhs)
+    # The right-hand sides are independent, so they can still be split
+    # by columns
+    task.add_broadcast(rhs, axes=(0,))
+    task.add_scalar_arg(pivots is not None, bool)
+    task.add_scalar_arg(lower, bool)
+    task.add_scalar_arg(upper, bool)
+    task.add_scalar_arg(offset, ty.int64)
+    task.execute()
+
+
+def getrs(
+    context: Context,
+    p_rhs: StorePartition,
+    launch_domain: Rect,
+    lu: Optional[Store],
+    pivots: Optional[Store],
+    offset: int,
+    lower: bool = False,
+    upper: bool = False,
+) -> None:
+    task = context.create_manual_task(
+        CuNumericOpCode.GETRS, launch_domain=launch_domain
+    )
+    task.add_output(p_rhs)
+    if lower or upper:
+        assert lu is not None
+        task.add_input(lu)
+    if pivots is not None:
+        task.add_input(pivots)
+    task.add_input(p_rhs)
+    task.add_scalar_arg(pivots is not None, bool)
+    task.add_scalar_arg(lower, bool)
+    task.add_scalar_arg(upper, bool)
+    task.add_scalar_arg(offset, ty.int64)
+    task.execute()
+
+
+def gemm(
+    context: Context,
+    p_lhs: StorePartition,
+    p_lu: StorePartition,
+    launch_domain: Rect,
+    i: int,
+) -> None:
+    task = context.create_manual_task(
+        CuNumericOpCode.GEMM, launch_domain=launch_domain
+    )
+    task.add_output(p_lhs)
+    task.add_input(p_lu, proj=lambda p: (p[0], i))
+    task.add_input(p_lhs, proj=lambda p: (i, p[1]))
+    task.add_input(p_lhs)
+    # Computes lhs -= rhs1 @ rhs2 without transposing rhs2
+    task.add_scalar_arg(False, bool)
+    task.execute()
+
+
+def lu_factor(
+    context: Context, lu: Store, pivots: Store, tile_size: int, n: int
+) -> StorePartition:
+    # Right-looking blocked LU with partial pivoting. Each step factors a
+    # tall panel, applies its row interchanges to the other columns,
+    # computes the block row of U and updates the trailing submatrix.
+    extent = lu.shape[0]
+    p_lu = lu.partition_by_tiling((tile_size, tile_size))
+
+    for i in range(n):
+        c0 = i * tile_size
+        c1 = min(c0 + tile_size, extent)
+
+        rows = lu.slice(0, slice(c0, None))
+        panel = rows.slice(1, slice(c0, c1))
+        panel_pivots = pivots.slice(0, slice(c0, c1))
+        getrf(context, panel, panel_pivots, c0)
+
+        p_rows = rows.partition_by_tiling((extent - c0, tile_size))
+        # Columns to the left only need the row interchanges
+        if i > 0:
+            getrs(
+                context,
+                p_rows,
+                Rect(lo=(0, 0), hi=(1, i)),
+                None,
+                panel_pivots,
+                c0,
+            )
+        if i + 1 >= n:
+            continue
+        # Columns to the right also get their block row of U
+        getrs(
+            context,
+            p_rows,
+            Rect(lo=(0, i + 1), hi=(1, n)),
+            panel,
+            panel_pivots,
+            c0,
+            lower=True,
+        )
+        gemm(context, p_lu, p_lu, Rect(lo=(i + 1, i + 1), hi=(n, n)), i)
+
+    return p_lu
+
+
+def lu_solve(
+    context: Context, p_lu: StorePartition, p_rhs: StorePartition, n: int
+) -> None:
+    # Forward substitution with the unit lower triangular factor
+    for i in range(n):
+        lu = p_lu.get_child_store(i, i)
+        launch_domain = Rect(lo=(i, 0), hi=(i + 1, 1))
+        getrs(context, p_rhs, launch_domain, lu, None, 0, lower=True)
+        if i + 1 < n:
+            gemm(context, p_rhs, p_lu, Rect(lo=(i + 1, 0), hi=(n, 1)), i)
+
+    # Backward substitution with the upper triangular factor
+    for i in reversed(range(n)):
+        lu = p_lu.get_child_store(i, i)
+        launch_domain = Rect(lo=(i, 0), hi=(i + 1, 1))
+        getrs(context, p_rhs, launch_domain, lu, None, 0, upper=True)
+        if i > 0:
+            gemm(context, p_rhs, p_lu, Rect(lo=(0, 0), hi=(i, 1)), i)
+
+
+def solve(output: DeferredArray, a: DeferredArray, b: DeferredArray) -> None:
+    runtime = output.runtime
+    context = output.context
+
+    # The factorization is computed in place, so work on a copy of `a`
+    lu = runtime.create_empty_thunk(a.shape, a.dtype, inputs=(a,))
+    lu.copy(a, deep=True)
+    output.copy(b, deep=True)
+
+    extent = a.shape[0]
+    pivots = context.create_store(ty.int32, shape=(extent,))
+
+    if runtime.num_procs == 1:
+        getrf(context, lu.base, pivots, 0)
+        getrs_single(
+            context, output.base, lu.base, pivots, 0, lower=True, upper=True
+        )
+        return
+
+    shape = lu.base.shape
+    initial_color_shape = choose_color_shape(runtime, shape, a.dtype)
+    tile_shape = (shape + initial_color_shape - 1) // initial_color_shape
+    color_shape = (shape + tile_shape - 1) // tile_shape
+    tile_size = tile_shape[0]
+    n = color_shape[0]
+
+    p_lu = lu_factor(context, lu.base, pivots, tile_size, n)
+
+    # Pivots hold global row indices, so they can be applied to all
+    # right-hand sides at once before the triangular solves
+    getrs_single(context, output.base, None, pivots, 0)
+
+    p_rhs = output.base.partition_by_tiling((tile_size, output.shape[1]))
+    lu_solve(context, p_lu, p_rhs, n)
@@ -0,0 +1,113 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from cunumeric.config import CuNumericOpCode
+
+from legate.core import Rect
+
+if TYPE_CHECKING:
+    from legate.core.context import Context
+    from legate.core.store import Store, StorePartition
+
+    from ..runtime import Runtime
+
+
+# SUMMA only pays off when the matrices are large enough that reducing
+# the partial products of the default matmul would dominate the runtime
+MIN_SUMMA_MATRIX_SIZE = 16384
+MIN_SUMMA_PROCS = 4
+
+
+def use_summa(runtime: Runtime, m: int, n: int, k: int) -> bool:
+    if m == 0 or n == 0 or k == 0:
+        return False
+    return (
+        runtime.num_procs >= MIN_SUMMA_PROCS
+        and min(m, n, k) >= MIN_SUMMA_MATRIX_SIZE
+    )
+
+
+# Factors the processors into a grid for the output matrix. Each step of
+# SUMMA sends every processor a (m / pm) x kb panel of rhs1 and a
+# kb x (n / pn) panel of rhs2, so the grid minimizing the sum of the
+# output tile's extents moves the least data.
+def choose_grid(num_procs: int, m: int, n: int) -> tuple[int, int]:
+    best_grid = (num_procs, 1)
+    best_cost = None
+    for pm in range(1, num_procs + 1):
+        if num_procs % pm != 0:
+            continue
+        pn = num_procs // pm
+        cost = (m + pm - 1) // pm + (n + pn - 1) // pn
+        if best_cost is None or cost < best_cost:
+            best_grid = (pm, pn)
+            best_cost = cost
+    return best_grid
+
+
+def multiply_panels(
+    context: Context,
+    launch_domain: Rect,
+    p_lhs: StorePartition,
+    p_rhs1: StorePartition,
+    p_rhs2: StorePartition,
+    i: int,
+) -> None:
+    task = context.create_manual_task(
+        CuNumericOpCode.MATMUL, launch_domain=launch_domain
+    )
+    task.add_output(p_lhs)
+    task.add_input(p_rhs1, proj=lambda p: (p[0], i))
+    task.add_input(p_rhs2, proj=lambda p: (i, p[1]))
+    task.add_input(p_lhs)
+    task.execute()
+
+
+def summa(runtime: Runtime, lhs: Store, rhs1: Store, rhs2: Store) -> None:
+    context = runtime.legate_context
+
+    m, n = lhs.shape
+    k = rhs1.shape[1]
+
+    if runtime.args.test_mode:
+        pm, pn = choose_grid(runtime.num_procs * 2, m, n)
+    else:
+        pm, pn = choose_grid(runtime.num_procs, m, n)
+    tile_shape = ((m + pm - 1) // pm, (n + pn - 1) // pn)
+    color_shape = (
+        (m + tile_shape[0] - 1) // tile_shape[0],
+        (n + tile_shape[1] - 1) // tile_shape[1],
+    )
+
+    # The panels are as wide as the longer side of the output tiles
+    panel_size = max(tile_shape)
+    if runtime.args.test_mode:
+        panel_size = min(panel_size, (k + 1) // 2)
+    num_panels = (k + panel_size - 1) // panel_size
+
+    p_lhs = lhs.partition_by_tiling(tile_shape)
+    p_rhs1 = rhs1.partition_by_tiling((tile_shape[0], panel_size))
+    p_rhs2 = rhs2.partition_by_tiling((panel_size, tile_shape[1]))
+
+    # Every step broadcasts a panel of rhs1 along the rows of the grid and
+    # a panel of rhs2 along its columns, and accumulates their product
+    # into the output tiles in place. Unlike the default matmul, the
+    # partial products are never materialized and reduced.
+    launch_domain = Rect(hi=color_shape)
+    for i in range(num_panels):
+        multiply_panels(context, launch_domain, p_lhs, p_rhs1, p_rhs2, i)
@@ -0,0 +1,96 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Optional
+
+from cunumeric.config import CuNumericOpCode
+
+from .exception import LinAlgError
+from .qr import choose_tile_size, qr
+
+if TYPE_CHECKING:
+    from legate.core.context import Context
+    from legate.core.store import Store
+
+    from ..deferred import DeferredArray
+
+
+def gesvd(
+    context: Context,
+    a: Store,
+    s: Store,
+    u: Optional[Store],
+    vh: Optional[Store],
+    full_matrices: bool,
+) -> None:
+    task = context.create_auto_task(CuNumericOpCode.GESVD)
+    task.throws_exception(LinAlgError)
+    task.add_input(a)
+    task.add_output(s)
+    task.add_broadcast(a)
+    task.add_broadcast(s)
+    if u is not None:
+        assert vh is not None
+        task.add_output(u)
+        task.add_output(vh)
+        task.add_broadcast(u)
+        task.add_broadcast(vh)
+    task.add_scalar_arg(full_matrices, bool)
+    task.execute()
+
+
+def svd(
+    s: DeferredArray,
+    a: DeferredArray,
+    u: Optional[DeferredArray],
+    vh: Optional[DeferredArray],
+    full_matrices: bool,
+) -> None:
+    runtime = s.runtime
+    context = s.context
+
+    m, n = a.shape
+    assert m >= n
+
+    # The complete U factor of a tall matrix can't be assembled from the
+    # tall-skinny QR, so that case is computed on a single processor
+    if full_matrices or choose_tile_size(runtime, m, n) >= m:
+        gesvd(
+            context,
+            a.base,
+            s.base,
+            None if u is None else u.base,
+            None if vh is None else vh.base,
+            full_matrices,
+        )
+        return
+
+    # With a = q @ r and r = u_r @ diag(s) @ vh, the left singular vectors
+    # of a are q @ u_r. The SVD of the small r runs on a single processor.
+    r = runtime.create_empty_thunk((n, n), a.dtype, inputs=(a,))
+    if u is None:
+        qr(r, a, None)
+        gesvd(context, r.base, s.base, None, None, False)
+        return
+
+    assert vh is not None
+    q = runtime.create_empty_thunk((m, n), a.dtype, inputs=(a,))
+    u_r = runtime.create_empty_thunk((n, n), a.dtype, inputs=(a,))
+    qr(r, a, q)
+    gesvd(context, r.base, s.base, u_r.base, vh.base, False)
+
+    mode2extent = {"a": m, "b": n, "c": n}
+    u.contract(["a", "c"], q, ["a", "b"], u_r, ["b", "c"], mode2extent)
@@ -1347,6 +1347,12 @@ def _collect_outshape_slices(
     return out_shape, slices, inputs
 
 
+# Largest total size of the inputs that concatenation copies in a single task
+# rather than with copies of their own. Every point task of that task
+# receives all of them, so the bound applies to their sum.
+_MAX_CONCATENATE_BROADCAST_BYTES = 1 << 22
+
+
 def _concatenate(
     inputs: Sequence[ndarray],
     common_info: ArrayInfo,
@@ -1376,8 +1382,31 @@ def _concatenate(
             )
         out_array = out
 
-    for dest, src in zip(slices, inputs):
-        out_array[(Ellipsis,) + dest] = src
+    # Inputs small enough to be broadcast are copied by a single task, whose
+    # point tasks fill their tiles of the output from whichever of them
+    # overlap. It writes whole tiles, so it has to run before the remaining
+    # inputs are copied one by one.
+    broadcast: set[int] = set()
+    broadcast_bytes = 0
+    for idx, src in enumerate(inputs):
+        if src.dtype != out_array.dtype:
+            continue
+        if broadcast_bytes + src.nbytes > _MAX_CONCATENATE_BROADCAST_BYTES:
+            continue
+        broadcast.add(idx)
+        broadcast_bytes += src.nbytes
+    if len(broadcast) > 1:
+        out_array._thunk.concatenate(
+            [inputs[idx]._thunk for idx in sorted(broadcast)],
+            axis,
+            [slices[idx][0].start for idx in sorted(broadcast)],
+        )
+    else:
+        broadcast.clear()
+
+    for idx, (dest, src) in enumerate(zip(slices, inputs)):
+        if idx not in broadcast:
+            out_array[(Ellipsis,) + dest] = src
 
     return out_array
 
@@ -2897,7 +2926,9 @@ def matmul(
     of allowed broadcasting, e.g. ``matmul(ones((3,1)), ones((4,5)))`` is
     allowed.
 
-    Only floating-point types are supported.
+    Only floating-point types and int8 are supported. Products of int8
+    operands are accumulated in int32, and can be returned as such by
+    passing ``dtype=int32`` or an int32 `out` array.
 
     See Also
     --------
@@ -3141,9 +3172,18 @@ def _contract(
         c_dtype = a.dtype
     else:
         c_dtype = ndarray.find_common_type(a, b)
-    a = _maybe_cast_input(a, c_dtype, casting)
-    if b is not None:
-        b = _maybe_cast_input(b, c_dtype, casting)
+    # The matrix tasks multiply int8 operands into an int32 result directly,
+    # so these operands are only widened if they don't end up in one
+    keep_int8 = (
+        b is not None
+        and c_dtype == np.int32
+        and a.dtype == np.int8
+        and b.dtype == np.int8
+    )
+    if not keep_int8:
+        a = _maybe_cast_input(a, c_dtype, casting)
+        if b is not None:
+            b = _maybe_cast_input(b, c_dtype, casting)
     out_dtype = out.dtype if out is not None else c_dtype
 
     # Handle duplicate modes on inputs
@@ -3229,6 +3269,19 @@ def _contract(
         if extent != prev_extent:
             raise ValueError("Wrong shape on output array")
 
+    # Summing out modes widens int8 operands, and the unary cases multiply
+    # them elementwise, so these get operands of the result type
+    if keep_int8:
+        assert b is not None
+        if (
+            a.dtype != np.int8
+            or b.dtype != np.int8
+            or len(a_modes) == 0
+            or len(b_modes) == 0
+        ):
+            a = a.astype(c_dtype)
+            b = b.astype(c_dtype)
+
     # Test for fallback to unary case
     if b is not None:
         if len(a_modes) == 0:
@@ -3264,6 +3317,7 @@ def _contract(
                 shape=c_shape,
                 dtype=c_dtype,
                 inputs=(a, b),
+                op="contract",
             )
         # Perform operation
         c._thunk.contract(
@@ -4629,7 +4683,7 @@ def sort(
     --------
     Multiple GPUs, Single CPU
     """
-    result = ndarray(a.shape, a.dtype)
+    result = ndarray(a.shape, a.dtype, inputs=(a,), op="sort")
     result._thunk.sort(rhs=a._thunk, axis=axis, kind=kind, order=order)
     return result
 
@@ -0,0 +1,1046 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+import json
+import math
+import mmap
+import operator
+import os
+import struct
+import zipfile
+import zlib
+from itertools import product
+from typing import TYPE_CHECKING, Any, BinaryIO, Iterator, Mapping, Optional
+
+import numpy as np
+from numpy.lib import format as npy_format
+
+from legate.core import CustomSplit, Rect, ingest
+
+from .array import convert_to_cunumeric_ndarray, ndarray
+from .runtime import runtime
+
+if TYPE_CHECKING:
+    import numpy.typing as npt
+
+    from .types import NdShape, NdShapeLike
+
+# The fixed part of the local header of a zip member, and the offset of the
+# lengths of the variable parts that follow it
+_ZIP_LOCAL_HEADER_SIZE = 30
+_ZIP_LOCAL_LENGTHS_OFFSET = 26
+
+_ZIP_PREFIX = b"PK\x03\x04"
+
+# The long names of the modes of numpy.memmap
+_MMAP_MODES = {
+    "readonly": "r",
+    "copyonwrite": "c",
+    "readwrite": "r+",
+    "write": "w+",
+}
+
+# Modes whose writes must reach the file
+_MMAP_SHARED_MODES = ("r+", "w+")
+
+# The metadata file of a chunked array
+_CHUNKED_METADATA = ".zarray"
+
+# The default size of the chunks of a chunked array
+_CHUNK_BYTES = 4 << 20
+
+# Encodings in which numbers, delimiters and line ends are single ASCII bytes
+_TEXT_ENCODINGS = (
+    None,
+    "bytes",
+    "ascii",
+    "latin1",
+    "latin-1",
+    "utf-8",
+    "utf8",
+)
+
+
+def _is_path(file: Any) -> bool:
+    return isinstance(file, (str, os.PathLike))
+
+
+def _is_task_dtype(dtype: np.dtype[Any]) -> bool:
+    # Tasks copy the bytes of the file as they are, so they only handle
+    # plain types in the native byte order
+    return (
+        dtype.isnative
+        and dtype.fields is None
+        and dtype.subdtype is None
+        and runtime.is_supported_type(dtype)
+    )
+
+
+def _read_header(
+    f: BinaryIO,
+) -> Optional[tuple[NdShape, bool, np.dtype[Any]]]:
+    version = npy_format.read_magic(f)
+    if version == (1, 0):
+        return npy_format.read_array_header_1_0(f)
+    if version == (2, 0):
+        return npy_format.read_array_header_2_0(f)
+    return None
+
+
+def _write_header(f: BinaryIO, header: dict[str, Any]) -> None:
+    try:
+        npy_format.write_array_header_1_0(f, header)
+    except ValueError:
+        # The header of version 1.0 is limited to 64 KiB
+        npy_format.write_array_header_2_0(f, header)
+
+
+def _load_array(path: str, start: int) -> Optional[ndarray]:
+    """
+    Loads the array of the .npy data that starts at byte `start` of the
+    file, or returns None if tasks can't load it.
+    """
+    with open(path, "rb") as f:
+        f.seek(start)
+        header = _read_header(f)
+        offset = f.tell()
+    if header is None:
+        return None
+    shape, fortran_order, dtype = header
+    if len(shape) == 0 or not _is_task_dtype(dtype):
+        return None
+
+    result = ndarray(shape, dtype)
+    if result.nbytes > os.path.getsize(path) - offset:
+        raise ValueError(
+            f"{path} is too short for an array of shape {shape} and type "
+            f"{dtype}"
+        )
+    if result.size > 0:
+        result._thunk.load_npy(path, offset, fortran_order)
+    return result
+
+
+def _map_array(
+    path: str,
+    offset: int,
+    shape: NdShape,
+    dtype: np.dtype[Any],
+    fortran_order: bool,
+) -> ndarray:
+    """
+    Returns an array backed by private mappings of the file, one for each
+    tile of the array along its first dimension.
+    """
+    # A Fortran-order file is mapped as the transpose of the array
+    file_shape = tuple(reversed(shape)) if fortran_order else tuple(shape)
+    ndim = len(file_shape)
+    rows = math.ceil(file_shape[0] / runtime.num_procs)
+    num_tiles = math.ceil(file_shape[0] / rows)
+    row_bytes = math.prod(file_shape[1:]) * dtype.itemsize
+
+    def get_subdomain(color: Any) -> Rect:
+        lo = color[0] * rows
+        hi = min(lo + rows, file_shape[0])
+        return Rect(lo=(lo,) + (0,) * (ndim - 1), hi=(hi,) + file_shape[1:])
+
+    def get_buffer(color: Any) -> memoryview:
+        lo = color[0] * rows
+        hi = min(lo + rows, file_shape[0])
+        start = offset + lo * row_bytes
+        # Mappings must start at a multiple of the allocation granularity
+        skip = start % mmap.ALLOCATIONGRANULARITY
+        with open(path, "rb") as f:
+            # Pages are read as tasks touch them, and writes stay private
+            mapping = mmap.mmap(
+                f.fileno(),
+                skip + (hi - lo) * row_bytes,
+                access=mmap.ACCESS_COPY,
+                offset=start - skip,
+            )
+        # The view keeps the mapping alive for as long as the store uses it
+        return memoryview(mapping)[skip:]
+
+    colors = (num_tiles,) + (1,) * (ndim - 1)
+    data = ingest(
+        runtime.get_core_type(dtype),
+        file_shape,
+        colors,
+        CustomSplit(get_subdomain),
+        get_buffer,
+    )
+    result = convert_to_cunumeric_ndarray(data)
+    return result.transpose() if fortran_order else result
+
+
+def _map_npy(path: str, mode: str) -> Optional[ndarray]:
+    """
+    Maps the array of a .npy file, or returns None if it can't be mapped in
+    pieces.
+    """
+    with open(path, "rb") as f:
+        header = _read_header(f)
+        offset = f.tell()
+    if header is None:
+        return None
+    shape, fortran_order, dtype = header
+    if (
+        mode in _MMAP_SHARED_MODES
+        or math.prod(shape) == 0
+        or len(shape) == 0
+        or not _is_task_dtype(dtype)
+    ):
+        return None
+    return _map_array(path, offset, shape, dtype, fortran_order)
+
+
+def _member_data_offset(path: str, info: zipfile.ZipInfo) -> int:
+    # The data follows the local header of the member, whose extra field
+    # can differ from the one in the central directory
+    with open(path, "rb") as f:
+        f.seek(info.header_offset + _ZIP_LOCAL_LENGTHS_OFFSET)
+        name_length, extra_length = struct.unpack("<HH", f.read(4))
+    return (
+        info.header_offset
+        + _ZIP_LOCAL_HEADER_SIZE
+        + name_length
+        + extra_length
+    )
+
+
+class NpzFile(Mapping[str, Any]):
+    """
+    A dictionary-like object with lazy loading of the arrays in a .npz file.
+
+    Arrays that the archive stores without compression are loaded by tasks
+    that read their data in place. Compressed arrays are decompressed by
+    NumPy and then converted.
+
+    See Also
+    --------
+    numpy.lib.npyio.NpzFile
+    """
+
+    def __init__(self, path: str, allow_pickle: bool = False) -> None:
+        self._path = path
+        self._allow_pickle = allow_pickle
+        self._zip = zipfile.ZipFile(path)
+        self._members: dict[str, str] = {}
+        for name in self._zip.namelist():
+            key = name[:-4] if name.endswith(".npy") else name
+            self._members[key] = name
+        self.files = list(self._members)
+
+    def __enter__(self) -> NpzFile:
+        return self
+
+    def __exit__(self, *args: Any) -> None:
+        self.close()
+
+    def close(self) -> None:
+        self._zip.close()
+
+    def __iter__(self) -> Iterator[str]:
+        return iter(self.files)
+
+    def __len__(self) -> int:
+        return len(self.files)
+
+    def __getitem__(self, key: str) -> Any:
+        if key not in self._members:
+            raise KeyError(f"{key} is not a file in the archive")
+        info = self._zip.getinfo(self._members[key])
+        if info.compress_type == zipfile.ZIP_STORED:
+            start = _member_data_offset(self._path, info)
+            result = _load_array(self._path, start)
+            if result is not None:
+                return result
+        with self._zip.open(info) as f:
+            magic = f.read(len(npy_format.MAGIC_PREFIX))
+        # Members that aren't arrays are returned as bytes, like NumPy does
+        if magic != npy_format.MAGIC_PREFIX:
+            return self._zip.read(info)
+        with self._zip.open(info) as f:
+            array = npy_format.read_array(f, allow_pickle=self._allow_pickle)
+        return convert_to_cunumeric_ndarray(array)
+
+
+def load(
+    file: Any,
+    mmap_mode: Optional[str] = None,
+    allow_pickle: bool = False,
+    fix_imports: bool = True,
+    encoding: str = "ASCII",
+) -> Any:
+    """
+    Load arrays or pickled objects from ``.npy``, ``.npz`` or pickled files.
+
+    Arrays in ``.npy`` files, and arrays stored without compression in
+    ``.npz`` files, are read by tasks. Each task reads the part of the file
+    that holds its tile of the array, so the data never passes through a
+    single process. With `mmap_mode`, ``.npy`` files are mapped as
+    described in :func:`memmap`. Other files, file objects and arrays of
+    types that tasks can't read go through NumPy.
+
+    Parameters
+    ----------
+    file : file-like object, string, or pathlib.Path
+        The file to read.
+    mmap_mode : {None, 'r+', 'r', 'w+', 'c'}, optional
+        If not None, then memory-map the file, using the given mode (see
+        `cunumeric.memmap` for a detailed description of the modes).
+    allow_pickle : bool, optional
+        Allow loading pickled object arrays stored in npy files.
+    fix_imports : bool, optional
+        Only useful when loading Python 2 generated pickled files.
+    encoding : str, optional
+        What encoding to use when reading Python 2 strings.
+
+    Returns
+    -------
+    result : ndarray, tuple, dict, etc.
+        Data stored in the file. For ``.npz`` files, the returned instance
+        of NpzFile class must be closed to avoid leaking file descriptors.
+
+    See Also
+    --------
+    numpy.load
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    if _is_path(file):
+        path = os.fspath(file)
+        with open(path, "rb") as f:
+            magic = f.read(len(npy_format.MAGIC_PREFIX))
+        if magic == npy_format.MAGIC_PREFIX:
+            if mmap_mode is None:
+                result = _load_array(path, 0)
+            else:
+                result = _map_npy(path, _MMAP_MODES.get(mmap_mode, mmap_mode))
+            if result is not None:
+                return result
+        elif magic.startswith(_ZIP_PREFIX):
+            return NpzFile(path, allow_pickle=allow_pickle)
+
+    result = np.load(
+        file,
+        mmap_mode=mmap_mode,
+        allow_pickle=allow_pickle,
+        fix_imports=fix_imports,
+        encoding=encoding,
+    )
+    if isinstance(result, np.ndarray):
+        # Arrays mapped for writing are attached, so that writes reach the
+        # file
+        share = _MMAP_MODES.get(mmap_mode, mmap_mode) in _MMAP_SHARED_MODES
+        return convert_to_cunumeric_ndarray(result, share=share)
+    return result
+
+
+def memmap(
+    filename: Any,
+    dtype: npt.DTypeLike = np.uint8,
+    mode: str = "r+",
+    offset: int = 0,
+    shape: Optional[NdShapeLike] = None,
+    order: str = "C",
+) -> ndarray:
+    """
+    Create an array backed by a memory map of an array stored in a binary
+    file on disk.
+
+    In the read-only and copy-on-write modes, each tile of the array along
+    its first dimension is backed by its own mapping of the part of the file
+    that holds it. Pages are read from disk only when tasks touch them, so
+    there is no staging copy of the file, and arrays larger than memory can
+    be processed piece by piece. Writes to these arrays are never written
+    back to the file.
+
+    In the read-write modes, the whole mapping is attached as a single
+    allocation, so that writes reach the file.
+
+    Parameters
+    ----------
+    filename : str, file-like object, or pathlib.Path instance
+        The file name or file object to be used as the array data buffer.
+    dtype : data-type, optional
+        The data-type used to interpret the file contents.
+        Default is `uint8`.
+    mode : {'r+', 'r', 'w+', 'c'}, optional
+        The file is opened in this mode:
+
+        +------+-------------------------------------------------------------+
+        | 'r'  | Open existing file for reading only.                        |
+        +------+-------------------------------------------------------------+
+        | 'r+' | Open existing file for reading and writing.                 |
+        +------+-------------------------------------------------------------+
+        | 'w+' | Create or overwrite existing file for reading and writing.  |
+        +------+-------------------------------------------------------------+
+        | 'c'  | Copy-on-write: writes affect data in memory, but changes    |
+        |      | are not saved to disk.                                      |
+        +------+-------------------------------------------------------------+
+
+        Default is 'r+'.
+    offset : int, optional
+        In the file, array data starts at this offset.
+    shape : tuple, optional
+        The desired shape of the array. If ``mode == 'r'`` and the number
+        of remaining bytes after `offset` is not a multiple of the byte-size
+        of `dtype`, you must specify `shape`. By default, the returned array
+        will be 1-D with the number of elements determined by file size
+        and data-type.
+    order : {'C', 'F'}, optional
+        Specify the order of the ndarray memory layout.
+
+    Returns
+    -------
+    out : ndarray
+        The array backed by the file.
+
+    See Also
+    --------
+    numpy.memmap
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    dtype = np.dtype(dtype)
+    mode = _MMAP_MODES.get(mode, mode)
+    if mode not in ("r", "c", "r+", "w+"):
+        raise ValueError(
+            f"mode must be one of 'r', 'c', 'r+' or 'w+', not {mode!r}"
+        )
+
+    if _is_path(filename) and mode not in _MMAP_SHARED_MODES:
+        path = os.fspath(filename)
+        size = os.path.getsize(path)
+        if shape is None:
+            shape = ((size - offset) // dtype.itemsize,)
+        elif isinstance(shape, int):
+            shape = (shape,)
+        shape = tuple(int(extent) for extent in shape)
+        if offset + math.prod(shape) * dtype.itemsize > size:
+            raise ValueError("mmap length is greater than file size")
+        if len(shape) > 0 and math.prod(shape) > 0 and _is_task_dtype(dtype):
+            return _map_array(path, offset, shape, dtype, order == "F")
+
+    array = np.memmap(
+        filename,
+        dtype=dtype,
+        mode=mode,
+        offset=offset,
+        shape=shape,
+        order=order,
+    )
+    return convert_to_cunumeric_ndarray(
+        array, share=mode in _MMAP_SHARED_MODES
+    )
+
+
+def save(
+    file: Any, arr: Any, allow_pickle: bool = True, fix_imports: bool = True
+) -> None:
+    """
+    Save an array to a binary file in NumPy ``.npy`` format.
+
+    When `file` is a path, the header is written first and then each task
+    writes its tile of the array to its place in the file, so the data never
+    passes through a single process. File objects, and arrays of types that
+    tasks can't write, go through NumPy. The function returns once the file
+    is complete.
+
+    Parameters
+    ----------
+    file : file, str, or pathlib.Path
+        File or filename to which the data is saved. If file is a string or
+        Path, a ``.npy`` extension will be appended to the filename if it
+        does not already have one.
+    arr : array_like
+        Array data to be saved.
+    allow_pickle : bool, optional
+        Allow saving object arrays using Python pickles.
+    fix_imports : bool, optional
+        Only useful in forcing objects in object arrays on Python 3 to be
+        pickled in a Python 2 compatible way.
+
+    See Also
+    --------
+    numpy.save
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    arr = convert_to_cunumeric_ndarray(arr)
+    if not _is_path(file) or arr.ndim == 0 or not _is_task_dtype(arr.dtype):
+        np.save(
+            file,
+            arr.__array__(),
+            allow_pickle=allow_pickle,
+            fix_imports=fix_imports,
+        )
+        return
+
+    path = os.fspath(file)
+    if not path.endswith(".npy"):
+        path += ".npy"
+    header = {
+        "descr": npy_format.dtype_to_descr(arr.dtype),
+        "fortran_order": False,
+        "shape": arr.shape,
+    }
+    with open(path, "wb") as f:
+        _write_header(f, header)
+        offset = f.tell()
+        # Tasks write into a file of the final size
+        f.truncate(offset + arr.nbytes)
+    if arr.size > 0:
+        arr._thunk.save_npy(path, offset)
+
+
+def _chunk_keys(
+    shape: NdShape, chunks: NdShape
+) -> Iterator[tuple[str, tuple[slice, ...]]]:
+    # Yields the file name of each chunk and the part of the array it holds
+    if len(shape) == 0:
+        yield "0", ()
+        return
+    grid = (range((e + c - 1) // c) for e, c in zip(shape, chunks))
+    for index in product(*grid):
+        key = ".".join(str(i) for i in index)
+        yield key, tuple(
+            slice(i * c, min((i + 1) * c, e))
+            for i, c, e in zip(index, chunks, shape)
+        )
+
+
+def _read_chunks(
+    array: npt.NDArray[Any],
+    path: str,
+    chunks: NdShape,
+    level: int,
+    shuffle: bool,
+) -> None:
+    # Reads the chunks in this process, as the tasks would
+    itemsize = array.dtype.itemsize
+    for key, part in _chunk_keys(array.shape, chunks):
+        chunk_path = os.path.join(path, key)
+        if not os.path.exists(chunk_path):
+            # Chunks that were never written hold the fill value, which is 0
+            array[part] = 0
+            continue
+        with open(chunk_path, "rb") as f:
+            data = f.read()
+        try:
+            if level >= 0:
+                data = zlib.decompress(data)
+            if shuffle:
+                shuffled = np.frombuffer(data, dtype=np.uint8)
+                data = shuffled.reshape(itemsize, -1).T.tobytes()
+            chunk = np.frombuffer(data, dtype=array.dtype).reshape(chunks)
+        except (zlib.error, ValueError) as e:
+            # Tasks report this the same way
+            raise OSError(f"Corrupt chunk {chunk_path}") from e
+        array[part] = chunk[tuple(slice(0, s.stop - s.start) for s in part)]
+
+
+def _write_chunks(
+    array: npt.NDArray[Any],
+    path: str,
+    chunks: NdShape,
+    level: int,
+    shuffle: bool,
+) -> None:
+    # Writes the chunks in this process, as the tasks would
+    itemsize = array.dtype.itemsize
+    for key, part in _chunk_keys(array.shape, chunks):
+        # Chunks at the edges of the array are padded with zeros
+        chunk = np.zeros(chunks, dtype=array.dtype)
+        chunk[tuple(slice(0, s.stop - s.start) for s in part)] = array[part]
+        data = chunk.tobytes()
+        if shuffle:
+            unshuffled = np.frombuffer(data, dtype=np.uint8)
+            data = unshuffled.reshape(-1, itemsize).T.tobytes()
+        if level >= 0:
+            data = zlib.compress(data, level)
+        with open(os.path.join(path, key), "wb") as f:
+            f.write(data)
+
+
+def _default_chunks(shape: NdShape, itemsize: int) -> NdShape:
+    # Halves the longest side of the chunk until it is small enough
+    chunks = list(shape)
+    while math.prod(chunks) * itemsize > _CHUNK_BYTES:
+        dim = max(range(len(chunks)), key=lambda d: chunks[d])
+        if chunks[dim] == 1:
+            break
+        chunks[dim] = (chunks[dim] + 1) // 2
+    return tuple(max(c, 1) for c in chunks)
+
+
+def _fill_value(dtype: np.dtype[Any]) -> Any:
+    if dtype.kind == "b":
+        return False
+    if dtype.kind == "c":
+        return [0.0, 0.0]
+    return 0
+
+
+def save_chunked(
+    path: Any,
+    arr: Any,
+    chunks: Optional[NdShapeLike] = None,
+    compression_level: Optional[int] = 1,
+    shuffle: bool = True,
+) -> None:
+    """
+    Save an array to a directory of separately stored chunks.
+
+    The array is split into a grid of chunks of equal shape, each of which
+    is stored in its own file, optionally byte-shuffled and compressed with
+    zlib. Each task writes the chunks of its own tile of the array, so the
+    data never passes through a single process, and loading the array
+    assigns whole chunks to each task. The directory follows the zarr (v2)
+    format, so it can also be read with the ``zarr`` package.
+
+    Parameters
+    ----------
+    path : str or pathlib.Path
+        The directory to save the array in. It is created if it doesn't
+        exist, and chunks already in it are overwritten.
+    arr : array_like
+        Array data to be saved.
+    chunks : int or tuple of ints, optional
+        The shape of the chunks. An int gives the extent of the chunks in
+        every dimension. By default, the chunks hold a few MiB each.
+    compression_level : int or None, optional
+        The zlib compression level, from 0 to 9, or None to store the chunks
+        uncompressed. Default is 1, which favors speed.
+    shuffle : bool, optional
+        Whether to group the bytes of the elements by significance before
+        compression, which helps compress numeric data. Default is True.
+
+    See Also
+    --------
+    load_chunked
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    arr = convert_to_cunumeric_ndarray(arr)
+    if chunks is None:
+        chunks = _default_chunks(arr.shape, arr.dtype.itemsize)
+    elif isinstance(chunks, int):
+        chunks = (chunks,) * arr.ndim
+    chunks = tuple(int(extent) for extent in chunks)
+    if len(chunks) != arr.ndim or any(extent < 1 for extent in chunks):
+        raise ValueError(
+            f"chunks {chunks} are not valid for an array of shape "
+            f"{arr.shape}"
+        )
+    if compression_level is not None and not 0 <= compression_level <= 9:
+        raise ValueError(
+            f"compression_level must be between 0 and 9, not "
+            f"{compression_level}"
+        )
+    if arr.dtype.hasobject:
+        raise ValueError("object arrays can't be saved in chunks")
+
+    # Shuffling single bytes would leave them as they are
+    shuffle = shuffle and arr.dtype.itemsize > 1
+    compressor = None
+    level = -1
+    if compression_level is not None:
+        compressor = {"id": "zlib", "level": compression_level}
+        level = compression_level
+    filters = None
+    if shuffle:
+        filters = [{"id": "shuffle", "elementsize": arr.dtype.itemsize}]
+
+    path = os.fspath(path)
+    os.makedirs(path, exist_ok=True)
+    metadata = {
+        "zarr_format": 2,
+        "shape": list(arr.shape),
+        "chunks": list(chunks),
+        "dtype": arr.dtype.str,
+        "compressor": compressor,
+        "filters": filters,
+        "fill_value": _fill_value(arr.dtype),
+        "order": "C",
+        "dimension_separator": ".",
+    }
+    with open(os.path.join(path, _CHUNKED_METADATA), "w") as f:
+        json.dump(metadata, f)
+
+    if arr.ndim == 0 or arr.size == 0 or not _is_task_dtype(arr.dtype):
+        _write_chunks(arr.__array__(), path, chunks, level, shuffle)
+    else:
+        arr._thunk.save_chunks(path, chunks, level, shuffle)
+
+
+def load_chunked(path: Any) -> ndarray:
+    """
+    Load an array saved with :func:`save_chunked`.
+
+    Each task reads and decodes the chunks of its own tile of the array, and
+    the tiles are made of whole chunks, so the data never passes through a
+    single process. Arrays written by other tools in the zarr (v2) format
+    can be loaded as well, as long as they are in C order and use no codecs
+    other than zlib compression and byte shuffling.
+
+    Parameters
+    ----------
+    path : str or pathlib.Path
+        The directory that holds the array.
+
+    Returns
+    -------
+    result : ndarray
+        The array stored in the directory.
+
+    See Also
+    --------
+    save_chunked
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    path = os.fspath(path)
+    with open(os.path.join(path, _CHUNKED_METADATA)) as f:
+        metadata = json.load(f)
+
+    dtype = np.dtype(metadata["dtype"])
+    shape = tuple(metadata["shape"])
+    chunks = tuple(metadata["chunks"])
+    compressor = metadata.get("compressor")
+    filters = metadata.get("filters") or []
+    if metadata.get("zarr_format") != 2 or metadata.get("order") != "C":
+        raise ValueError(f"{path} is not a C-order array in zarr v2 format")
+    if metadata.get("dimension_separator", ".") != ".":
+        raise ValueError(f"{path} uses nested chunk directories")
+    if compressor is not None and compressor.get("id") != "zlib":
+        raise ValueError(f"compressor {compressor} is not supported")
+    shuffle = filters == [{"id": "shuffle", "elementsize": dtype.itemsize}]
+    if len(filters) > 0 and not shuffle:
+        raise ValueError(f"filters {filters} are not supported")
+    if metadata.get("fill_value") not in (None, _fill_value(dtype)):
+        raise ValueError("only arrays with a fill value of 0 are supported")
+
+    # Only whether chunks are compressed matters for reading them
+    level = -1 if compressor is None else 0
+    if len(shape) == 0 or math.prod(shape) == 0 or not _is_task_dtype(dtype):
+        result = np.empty(shape, dtype=dtype)
+        _read_chunks(result, path, chunks, level, shuffle)
+        return convert_to_cunumeric_ndarray(result)
+
+    result = ndarray(shape, dtype)
+    result._thunk.load_chunks(path, chunks, level, shuffle)
+    return result
+
+
+def _text_options(
+    fname: Any,
+    dtype: np.dtype[Any],
+    comments: Any,
+    delimiter: Any,
+    encoding: Optional[str],
+) -> Optional[tuple[str, str]]:
+    """
+    Returns the comment prefix and the delimiter to parse the file with in
+    tasks, or None if tasks can't parse it.
+    """
+    if (
+        not _is_path(fname)
+        or os.fspath(fname).endswith((".gz", ".bz2", ".xz"))
+        or not _is_task_dtype(dtype)
+        or dtype.kind not in "iuf"
+        or encoding not in _TEXT_ENCODINGS
+    ):
+        return None
+    if isinstance(comments, (list, tuple)) and len(comments) == 1:
+        comments = comments[0]
+    if comments is None:
+        comments = ""
+    if not isinstance(comments, str) or not comments.isascii():
+        return None
+    if delimiter is None:
+        delimiter = ""
+    elif (
+        not isinstance(delimiter, str)
+        or len(delimiter) != 1
+        or not delimiter.isascii()
+        or delimiter == "\n"
+    ):
+        return None
+    return comments, delimiter
+
+
+def _split_line(line: bytes, comments: str, delimiter: str) -> list[str]:
+    # Splits the line the way the tasks do
+    text = line.decode("latin-1")
+    if comments:
+        text = text.split(comments, 1)[0]
+    text = text.strip()
+    if not text:
+        return []
+    return text.split(delimiter) if delimiter else text.split()
+
+
+def _load_text(
+    path: str,
+    skiprows: int,
+    dtype: np.dtype[Any],
+    comments: str,
+    delimiter: str,
+    usecols: Any,
+    strict: bool,
+    fill: float,
+) -> Optional[ndarray]:
+    """
+    Parses the file into a 2-D array of the selected columns, or returns None
+    if tasks can't parse it.
+    """
+    with open(path, "rb") as f:
+        for _ in range(skiprows):
+            f.readline()
+        begin = f.tell()
+        # The first line with values gives the number of columns
+        num_columns = 0
+        for line in f:
+            fields = _split_line(line, comments, delimiter)
+            if fields:
+                num_columns = len(fields)
+                break
+    if num_columns == 0:
+        return None
+
+    if usecols is None:
+        columns = list(range(num_columns))
+    else:
+        if isinstance(usecols, int):
+            usecols = (usecols,)
+        columns = [operator.index(column) for column in usecols]
+        if any(not -num_columns <= column < num_columns for column in columns):
+            return None
+        columns = [column % num_columns for column in columns]
+
+    thunk = runtime.create_unbound_thunk(dtype)
+    thunk.load_text(
+        path,
+        begin,
+        os.path.getsize(path),
+        delimiter,
+        comments,
+        num_columns,
+        columns,
+        strict,
+        fill,
+    )
+    result = ndarray(shape=None, thunk=thunk)
+    return result.reshape(-1, len(columns))
+
+
+def _ensure_ndmin(arr: ndarray, ndmin: int) -> ndarray:
+    # Follows numpy.loadtxt
+    if arr.ndim > ndmin:
+        arr = arr.squeeze()
+    if arr.ndim < ndmin:
+        if ndmin == 1:
+            arr = arr.reshape(1)
+        elif ndmin == 2:
+            arr = arr.reshape(-1, 1) if arr.ndim == 1 else arr.reshape(1, 1)
+    return arr
+
+
+def loadtxt(
+    fname: Any,
+    dtype: npt.DTypeLike = float,
+    comments: Any = "#",
+    delimiter: Optional[str] = None,
+    converters: Any = None,
+    skiprows: int = 0,
+    usecols: Any = None,
+    unpack: bool = False,
+    ndmin: int = 0,
+    encoding: Optional[str] = "bytes",
+    max_rows: Optional[int] = None,
+) -> ndarray:
+    """
+    Load data from a text file.
+
+    When `fname` is a path and the values are numbers, the file is split
+    among the tasks at line boundaries, and each task parses its lines
+    straight into its part of the array, so the text never passes through a
+    single process. Other files and options go through NumPy.
+
+    Parameters
+    ----------
+    fname : file, str, pathlib.Path, list of str, generator
+        File, filename, list, or generator to read.
+    dtype : data-type, optional
+        Data-type of the resulting array; default: float.
+    comments : str or sequence of str or None, optional
+        The characters or list of characters used to indicate the start of a
+        comment. None implies no comments. Default is '#'.
+    delimiter : str, optional
+        The string used to separate values. The default is whitespace.
+    converters : dict or callable, optional
+        Converter functions to customize value parsing.
+    skiprows : int, optional
+        Skip the first `skiprows` lines, including comments; default: 0.
+    usecols : int or sequence, optional
+        Which columns to read, with 0 being the first.
+    unpack : bool, optional
+        If True, the returned array is transposed, so that arguments may be
+        unpacked using ``x, y, z = loadtxt(...)``.
+    ndmin : int, optional
+        The returned array will have at least `ndmin` dimensions. Legal
+        values: 0 (default), 1 or 2.
+    encoding : str, optional
+        Encoding used to decode the inputfile.
+    max_rows : int, optional
+        Read `max_rows` rows of content after `skiprows` lines.
+
+    Returns
+    -------
+    out : ndarray
+        Data read from the text file.
+
+    See Also
+    --------
+    numpy.loadtxt
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    dtype = np.dtype(dtype)
+    options = _text_options(fname, dtype, comments, delimiter, encoding)
+    result = None
+    if options is not None and converters is None and max_rows is None:
+        result = _load_text(
+            os.fspath(fname), skiprows, dtype, *options, usecols, True, 0.0
+        )
+    if result is None:
+        return convert_to_cunumeric_ndarray(
+            np.loadtxt(
+                fname,
+                dtype=dtype,
+                comments=comments,
+                delimiter=delimiter,
+                converters=converters,
+                skiprows=skiprows,
+                usecols=usecols,
+                unpack=unpack,
+                ndmin=ndmin,
+                encoding=encoding,
+                max_rows=max_rows,
+            )
+        )
+    result = _ensure_ndmin(result, ndmin)
+    return result.T if unpack else result
+
+
+def genfromtxt(
+    fname: Any,
+    dtype: npt.DTypeLike = float,
+    comments: Any = "#",
+    delimiter: Optional[str] = None,
+    skip_header: int = 0,
+    usecols: Any = None,
+    unpack: Optional[bool] = None,
+    encoding: Optional[str] = "bytes",
+    **kwargs: Any,
+) -> ndarray:
+    """
+    Load data from a text file, with missing values handled as specified.
+
+    When `fname` is a path, the values are floating-point numbers and no
+    options beyond the ones listed here are given, the file is parsed in
+    tasks as in :func:`loadtxt`, and missing or invalid values become NaN.
+    Other files and options go through NumPy.
+
+    Parameters
+    ----------
+    fname : file, str, pathlib.Path, list of str, generator
+        File, filename, list, or generator to read.
+    dtype : dtype, optional
+        Data type of the resulting array; default: float.
+    comments : str, optional
+        The character used to indicate the start of a comment.
+    delimiter : str, optional
+        The string used to separate values. By default, any consecutive
+        whitespaces act as delimiter.
+    skip_header : int, optional
+        The number of lines to skip at the beginning of the file.
+    usecols : sequence, optional
+        Which columns to read, with 0 being the first.
+    unpack : bool, optional
+        If True, the returned array is transposed, so that arguments may be
+        unpacked using ``x, y, z = genfromtxt(...)``.
+    encoding : str, optional
+        Encoding used to decode the inputfile.
+    **kwargs
+        The other arguments of `numpy.genfromtxt`.
+
+    Returns
+    -------
+    out : ndarray
+        Data read from the text file.
+
+    See Also
+    --------
+    numpy.genfromtxt
+
+    Availability
+    --------
+    Multiple CPUs
+    """
+    dtype = np.dtype(dtype)
+    options = _text_options(fname, dtype, comments, delimiter, encoding)
+    result = None
+    if options is not None and dtype.kind == "f" and not kwargs:
+        result = _load_text(
+            os.fspath(fname),
+            skip_header,
+            dtype,
+            *options,
+            usecols,
+            False,
+            math.nan,
+        )
+    if result is None:
+        return convert_to_cunumeric_ndarray(
+            np.genfromtxt(
+                fname,
+                dtype=dtype,
+                comments=comments,
+                delimiter=delimiter,
+                skip_header=skip_header,
+                usecols=usecols,
+                unpack=unpack,
+                encoding=encoding,
+                **kwargs,
+            )
+        )
+    result = result.squeeze()
+    return result.T if unpack else result
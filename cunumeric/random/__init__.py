@@ -16,6 +16,12 @@ from __future__ import annotations
 
 import numpy.random as _nprandom
 from cunumeric.random.random import *
+from cunumeric.random.generator import (
+    BitGenerator,
+    Generator,
+    Philox,
+    default_rng,
+)
 from cunumeric.coverage import clone_module
 
 clone_module(_nprandom, globals())
@@ -0,0 +1,753 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Any, Sequence, Union
+
+import numpy as np
+from cunumeric.array import ndarray
+from cunumeric.config import RandGenCode
+from numpy.core.multiarray import normalize_axis_index  # type: ignore
+
+if TYPE_CHECKING:
+    import numpy.typing as npt
+
+_FLOAT_TYPES = (np.float16, np.float32, np.float64)
+
+_COUNTER_MODULUS = 2**64
+
+# Permutations sort random keys drawn from this range. Ties are broken by
+# position, and are rare enough not to bias the permutation measurably.
+_PERMUTATION_KEY_RANGE = 2**62
+
+_NORMAL_METHODS = {
+    "box-muller": RandGenCode.NORMAL,
+    "ziggurat": RandGenCode.NORMAL_ZIGGURAT,
+}
+
+
+def _normal_gen_code(method: str) -> RandGenCode:
+    if method not in _NORMAL_METHODS:
+        raise ValueError(
+            f"method must be one of {', '.join(_NORMAL_METHODS)}, "
+            f"not {method!r}"
+        )
+    return _NORMAL_METHODS[method]
+
+
+class BitGenerator:
+    """
+    Base class of the bit generators that drive a :class:`Generator`.
+
+    A bit generator holds the key of a counter-based engine and the next
+    counter to use. Every draw reserves one counter per element, so
+    successive draws never share values, and the values of a draw do not
+    depend on how the output is partitioned.
+
+    See Also
+    --------
+    numpy.random.BitGenerator
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+
+    def __init__(
+        self,
+        seed: Union[int, Sequence[int], np.random.SeedSequence, None] = None,
+    ) -> None:
+        if isinstance(seed, np.random.SeedSequence):
+            self._seed_seq = seed
+        else:
+            self._seed_seq = np.random.SeedSequence(seed)
+        key = self._seed_seq.generate_state(2, np.uint32)
+        self._key = (int(key[0]), int(key[1]))
+        self._counter = 0
+
+    @property
+    def seed_seq(self) -> np.random.SeedSequence:
+        return self._seed_seq
+
+    def spawn(self, n_children: int) -> list[BitGenerator]:
+        """
+        Create new independent child bit generators.
+
+        The children are seeded with the children of this generator's
+        seed sequence, so their streams do not overlap with this one.
+
+        See Also
+        --------
+        numpy.random.BitGenerator.spawn
+        """
+        return [type(self)(seq) for seq in self._seed_seq.spawn(n_children)]
+
+    def advance(self, delta: int) -> BitGenerator:
+        """
+        Advance the counter as if `delta` elements had been drawn.
+
+        See Also
+        --------
+        numpy.random.Philox.advance
+        """
+        self._counter = (self._counter + delta) % _COUNTER_MODULUS
+        return self
+
+    def _reserve(self, volume: int) -> tuple[tuple[int, int], int]:
+        counter = self._counter
+        self.advance(max(volume, 1))
+        return self._key, counter
+
+
+class Philox(BitGenerator):
+    """
+    Philox(seed=None, counter=None, key=None)
+
+    Container for the Philox-4x32 counter-based bit generator.
+
+    Parameters
+    ----------
+    seed : None, int, array_like[ints], SeedSequence, optional
+        The seed from which the key is derived. Ignored if `key` is given.
+    counter : int, optional
+        The counter of the first element of the next draw. Defaults to 0.
+    key : int, optional
+        A 64-bit key to use instead of one derived from `seed`.
+
+    See Also
+    --------
+    numpy.random.Philox
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+
+    def __init__(
+        self,
+        seed: Union[int, Sequence[int], np.random.SeedSequence, None] = None,
+        counter: Union[int, None] = None,
+        key: Union[int, None] = None,
+    ) -> None:
+        super().__init__(seed)
+        if key is not None:
+            key = int(key)
+            self._key = (key & 0xFFFFFFFF, (key >> 32) & 0xFFFFFFFF)
+        if counter is not None:
+            self._counter = int(counter) % _COUNTER_MODULUS
+
+
+def _shape_of(size: Union[int, Sequence[int], None]) -> tuple[int, ...]:
+    if size is None:
+        return (1,)
+    if isinstance(size, (int, np.integer)):
+        return (int(size),)
+    return tuple(int(extent) for extent in size)
+
+
+def _along_axis(axis: int, index: Any) -> tuple[Any, ...]:
+    return (slice(None),) * axis + (index,)
+
+
+# Builds the tables of Vose's alias method for the probabilities `p`. A
+# sample picks a column uniformly, keeps it with the probability in
+# `threshold` and takes its alias otherwise.
+def _alias_table(p: npt.NDArray[Any]) -> tuple[Any, Any]:
+    n = p.shape[0]
+    scaled = p * n
+    threshold = np.ones(n, dtype=np.float64)
+    alias = np.arange(n, dtype=np.int64)
+    small = [i for i in range(n) if scaled[i] < 1.0]
+    large = [i for i in range(n) if scaled[i] >= 1.0]
+    while small and large:
+        lo = small.pop()
+        hi = large.pop()
+        threshold[lo] = scaled[lo]
+        alias[lo] = hi
+        scaled[hi] += scaled[lo] - 1.0
+        (small if scaled[hi] < 1.0 else large).append(hi)
+    return threshold, alias
+
+
+def _check_scalar(name: str, value: Any) -> float:
+    if np.ndim(value) != 0:
+        raise NotImplementedError(
+            f"cunumeric.random.Generator only supports scalar '{name}'"
+        )
+    return float(value)
+
+
+class Generator:
+    """
+    Generator(bit_generator)
+
+    Container for the distributions of random values.
+
+    Every distribution is sampled by the RAND task on all partitions of
+    the output in parallel. Distribution parameters must be scalars.
+
+    Parameters
+    ----------
+    bit_generator : BitGenerator
+        The bit generator that supplies the keys and counters.
+
+    See Also
+    --------
+    numpy.random.Generator
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+
+    def __init__(self, bit_generator: BitGenerator) -> None:
+        self._bit_generator = bit_generator
+
+    @property
+    def bit_generator(self) -> BitGenerator:
+        return self._bit_generator
+
+    def spawn(self, n_children: int) -> list[Generator]:
+        """
+        Create new independent child generators.
+
+        See Also
+        --------
+        numpy.random.Generator.spawn
+        """
+        return [
+            Generator(child) for child in self._bit_generator.spawn(n_children)
+        ]
+
+    def _sample(
+        self,
+        gen_code: RandGenCode,
+        size: Union[int, Sequence[int], None],
+        dtype: npt.DTypeLike,
+        args: Sequence[Any] = (),
+    ) -> Union[Any, ndarray]:
+        shape = _shape_of(size)
+        result = ndarray(shape, dtype=np.dtype(dtype))
+        key, counter = self._bit_generator._reserve(result.size)
+        result._thunk.random_distribution(
+            gen_code,
+            key,
+            counter,
+            [np.asarray(arg) for arg in args],
+        )
+        if size is None:
+            return result.__array__()[0]
+        return result
+
+    def _sample_float(
+        self,
+        gen_code: RandGenCode,
+        size: Union[int, Sequence[int], None],
+        dtype: npt.DTypeLike,
+        *args: float,
+    ) -> Union[float, ndarray]:
+        dtype = np.dtype(dtype)
+        if dtype.type not in _FLOAT_TYPES:
+            raise TypeError(f"Unsupported dtype {dtype} for this distribution")
+        return self._sample(
+            gen_code, size, dtype, [np.float64(arg) for arg in args]
+        )
+
+    def random(
+        self,
+        size: Union[int, Sequence[int], None] = None,
+        dtype: npt.DTypeLike = np.float64,
+    ) -> Union[float, ndarray]:
+        """
+        Return random floats in the half-open interval [0.0, 1.0).
+
+        Unlike NumPy, float16 is supported as well as float32 and float64.
+
+        See Also
+        --------
+        numpy.random.Generator.random
+        """
+        return self._sample_float(RandGenCode.UNIFORM, size, dtype, 0.0, 1.0)
+
+    def uniform(
+        self,
+        low: float = 0.0,
+        high: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a uniform distribution over [low, high).
+
+        See Also
+        --------
+        numpy.random.Generator.uniform
+        """
+        low = _check_scalar("low", low)
+        high = _check_scalar("high", high)
+        return self._sample_float(
+            RandGenCode.UNIFORM, size, np.float64, low, high
+        )
+
+    def integers(
+        self,
+        low: int,
+        high: Union[int, None] = None,
+        size: Union[int, Sequence[int], None] = None,
+        dtype: npt.DTypeLike = np.int64,
+        endpoint: bool = False,
+    ) -> Union[int, ndarray]:
+        """
+        Return random integers from `low` (inclusive) to `high`
+        (exclusive), or to `high` (inclusive) if `endpoint` is True.
+
+        See Also
+        --------
+        numpy.random.Generator.integers
+        """
+        dtype = np.dtype(dtype)
+        if dtype.kind not in ("i", "u"):
+            raise TypeError(f"Unsupported dtype {dtype} for integers")
+        if np.ndim(low) != 0 or np.ndim(high) != 0:
+            raise NotImplementedError(
+                "cunumeric.random.Generator.integers only supports scalar "
+                "bounds"
+            )
+        if high is None:
+            low, high = 0, low
+        low = int(low)
+        high = int(high) + (1 if endpoint else 0)
+        if low >= high:
+            raise ValueError("low >= high")
+        info = np.iinfo(dtype)
+        if low < info.min or high - 1 > info.max:
+            raise ValueError(f"bounds are out of range for {dtype}")
+        # The bounds are passed to the generator as 64-bit integers
+        if high > np.iinfo(np.int64).max:
+            raise NotImplementedError(
+                "cunumeric.random.Generator.integers does not support "
+                "bounds above the maximum of int64"
+            )
+        return self._sample(
+            RandGenCode.INTEGER,
+            size,
+            dtype,
+            [np.int64(low), np.int64(high)],
+        )
+
+    def standard_normal(
+        self,
+        size: Union[int, Sequence[int], None] = None,
+        dtype: npt.DTypeLike = np.float64,
+        method: str = "box-muller",
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a standard Normal distribution (mean=0, stdev=1).
+
+        Parameters
+        ----------
+        method : {'box-muller', 'ziggurat'}, optional
+            The transform from uniform values. Box-Muller computes two
+            samples from each pair of uniform values and takes a fixed
+            amount of work per sample. The ziggurat method avoids the
+            logarithm and trigonometric functions for most samples, but
+            each sample evaluates the engine for itself and its rare
+            rejections draw additional values, so it is usually slower
+            than Box-Muller. Both are reproducible for a given seed.
+
+        See Also
+        --------
+        numpy.random.Generator.standard_normal
+        """
+        return self._sample_float(
+            _normal_gen_code(method), size, dtype, 0.0, 1.0
+        )
+
+    def normal(
+        self,
+        loc: float = 0.0,
+        scale: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+        method: str = "box-muller",
+    ) -> Union[float, ndarray]:
+        """
+        Draw random samples from a normal (Gaussian) distribution.
+
+        `method` selects the transform, as in :meth:`standard_normal`.
+
+        See Also
+        --------
+        numpy.random.Generator.normal
+        """
+        loc = _check_scalar("loc", loc)
+        scale = _check_scalar("scale", scale)
+        if scale < 0:
+            raise ValueError("scale < 0")
+        return self._sample_float(
+            _normal_gen_code(method), size, np.float64, loc, scale
+        )
+
+    def standard_exponential(
+        self,
+        size: Union[int, Sequence[int], None] = None,
+        dtype: npt.DTypeLike = np.float64,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from the standard exponential distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.standard_exponential
+        """
+        return self._sample_float(RandGenCode.EXPONENTIAL, size, dtype, 1.0)
+
+    def exponential(
+        self,
+        scale: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from an exponential distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.exponential
+        """
+        scale = _check_scalar("scale", scale)
+        if scale < 0:
+            raise ValueError("scale < 0")
+        return self._sample_float(
+            RandGenCode.EXPONENTIAL, size, np.float64, scale
+        )
+
+    def lognormal(
+        self,
+        mean: float = 0.0,
+        sigma: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a log-normal distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.lognormal
+        """
+        mean = _check_scalar("mean", mean)
+        sigma = _check_scalar("sigma", sigma)
+        if sigma < 0:
+            raise ValueError("sigma < 0")
+        return self._sample_float(
+            RandGenCode.LOGNORMAL, size, np.float64, mean, sigma
+        )
+
+    def standard_gamma(
+        self,
+        shape: float,
+        size: Union[int, Sequence[int], None] = None,
+        dtype: npt.DTypeLike = np.float64,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a standard Gamma distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.standard_gamma
+        """
+        shape = _check_scalar("shape", shape)
+        if shape < 0:
+            raise ValueError("shape < 0")
+        return self._sample_float(RandGenCode.GAMMA, size, dtype, shape, 1.0)
+
+    def gamma(
+        self,
+        shape: float,
+        scale: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a Gamma distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.gamma
+        """
+        shape = _check_scalar("shape", shape)
+        scale = _check_scalar("scale", scale)
+        if shape < 0:
+            raise ValueError("shape < 0")
+        if scale < 0:
+            raise ValueError("scale < 0")
+        return self._sample_float(
+            RandGenCode.GAMMA, size, np.float64, shape, scale
+        )
+
+    def beta(
+        self,
+        a: float,
+        b: float,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[float, ndarray]:
+        """
+        Draw samples from a Beta distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.beta
+        """
+        a = _check_scalar("a", a)
+        b = _check_scalar("b", b)
+        if a <= 0:
+            raise ValueError("a <= 0")
+        if b <= 0:
+            raise ValueError("b <= 0")
+        return self._sample_float(RandGenCode.BETA, size, np.float64, a, b)
+
+    def poisson(
+        self,
+        lam: float = 1.0,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[int, ndarray]:
+        """
+        Draw samples from a Poisson distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.poisson
+        """
+        lam = _check_scalar("lam", lam)
+        if lam < 0:
+            raise ValueError("lam < 0")
+        return self._sample(
+            RandGenCode.POISSON, size, np.int64, [np.float64(lam)]
+        )
+
+    def binomial(
+        self,
+        n: int,
+        p: float,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> Union[int, ndarray]:
+        """
+        Draw samples from a binomial distribution.
+
+        See Also
+        --------
+        numpy.random.Generator.binomial
+        """
+        n = _check_scalar("n", n)
+        p = _check_scalar("p", p)
+        if n < 0:
+            raise ValueError("n < 0")
+        if p < 0 or p > 1 or np.isnan(p):
+            raise ValueError("p < 0, p > 1 or p is NaN")
+        return self._sample(
+            RandGenCode.BINOMIAL,
+            size,
+            np.int64,
+            [np.float64(int(n)), np.float64(p)],
+        )
+
+    def _permutation_indices(self, n: int) -> ndarray:
+        from cunumeric.module import argsort
+
+        # Sorting random keys gives a uniformly random permutation, and
+        # both steps run in parallel on every partition of the keys
+        keys = self.integers(0, _PERMUTATION_KEY_RANGE, size=n)
+        return argsort(keys, kind="stable")
+
+    def permutation(
+        self, x: Union[int, npt.ArrayLike], axis: int = 0
+    ) -> ndarray:
+        """
+        Randomly permute a sequence, or return a permuted range.
+
+        The permutation sorts random keys and then gathers the elements,
+        so the array is never collected on a single process.
+
+        See Also
+        --------
+        numpy.random.Generator.permutation
+        """
+        from cunumeric.module import asarray
+
+        if isinstance(x, (int, np.integer)):
+            return self._permutation_indices(int(x))
+        arr = asarray(x)
+        if arr.ndim == 0:
+            raise ValueError("x must be an integer or at least 1-dimensional")
+        axis = normalize_axis_index(axis, arr.ndim)
+        perm = self._permutation_indices(arr.shape[axis])
+        return arr[_along_axis(axis, perm)]
+
+    def shuffle(self, x: ndarray, axis: int = 0) -> None:
+        """
+        Modify an array in-place by shuffling its contents.
+
+        See Also
+        --------
+        numpy.random.Generator.shuffle
+        """
+        if not isinstance(x, ndarray):
+            raise TypeError("x must be a cunumeric array")
+        x[...] = self.permutation(x, axis=axis)
+
+    def choice(
+        self,
+        a: Union[int, npt.ArrayLike],
+        size: Union[int, Sequence[int], None] = None,
+        replace: bool = True,
+        p: Union[npt.ArrayLike, None] = None,
+        axis: int = 0,
+    ) -> Union[Any, ndarray]:
+        """
+        Generates a random sample from a given array.
+
+        Samples with replacement draw random indices and gather them.
+        Weighted samples with replacement use an alias table, which is
+        built on the host from `p`. Samples without replacement take the
+        first indices of a permutation, or, when weighted, the indices with
+        the largest keys ``log(u) / p``.
+
+        See Also
+        --------
+        numpy.random.Generator.choice
+        """
+        from cunumeric._ufunc.math import log
+        from cunumeric.module import argsort, asarray, where
+
+        if isinstance(a, (int, np.integer)):
+            population = None
+            pop_size = int(a)
+            if pop_size < 0:
+                raise ValueError("a must be a positive integer")
+        else:
+            population = asarray(a)
+            if population.ndim == 0:
+                raise ValueError("a must be a sequence or an integer")
+            axis = normalize_axis_index(axis, population.ndim)
+            pop_size = population.shape[axis]
+
+        shape = _shape_of(size)
+        count = int(np.prod(shape))
+        if pop_size == 0 and count > 0:
+            raise ValueError("a cannot be empty unless no samples are taken")
+
+        probs = None
+        if p is not None:
+            probs = np.asarray(p, dtype=np.float64)
+            if probs.ndim != 1:
+                raise ValueError("p must be 1-dimensional")
+            if probs.shape[0] != pop_size:
+                raise ValueError("a and p must have same size")
+            if np.any(probs < 0):
+                raise ValueError("probabilities are not non-negative")
+            atol = np.sqrt(np.finfo(np.float64).eps)
+            if abs(probs.sum() - 1.0) > atol:
+                raise ValueError("probabilities do not sum to 1")
+
+        if replace:
+            if probs is None:
+                index = self.integers(0, max(pop_size, 1), size=shape)
+            else:
+                threshold, alias = _alias_table(probs)
+                column = self.integers(0, pop_size, size=shape)
+                keep = self.random(shape) < asarray(threshold)[column]
+                index = where(keep, column, asarray(alias)[column])
+        else:
+            if count > pop_size:
+                raise ValueError(
+                    "Cannot take a larger sample than population when "
+                    "replace is False"
+                )
+            if probs is None:
+                index = self._permutation_indices(pop_size)[:count]
+            else:
+                if np.count_nonzero(probs) < count:
+                    raise ValueError("Fewer non-zero entries in p than size")
+                keys = log(self.random(pop_size)) / asarray(probs)
+                index = argsort(-keys, kind="stable")[:count]
+            index = index.reshape(shape)
+
+        if population is None:
+            result = index
+        else:
+            result = population[_along_axis(axis, index)]
+        if size is None:
+            if population is None or population.ndim == 1:
+                return result.__array__()[0]
+            return result[_along_axis(axis, 0)]
+        return result
+
+    def multivariate_normal(
+        self,
+        mean: npt.ArrayLike,
+        cov: npt.ArrayLike,
+        size: Union[int, Sequence[int], None] = None,
+    ) -> ndarray:
+        """
+        Draw random samples from a multivariate normal distribution.
+
+        Unlike NumPy, the covariance matrix is factored with a Cholesky
+        decomposition, so it must be positive definite.
+
+        See Also
+        --------
+        numpy.random.Generator.multivariate_normal
+        """
+        from cunumeric.linalg import cholesky
+        from cunumeric.module import asarray
+
+        mean = asarray(mean, dtype=np.float64)
+        cov = asarray(cov, dtype=np.float64)
+        if mean.ndim != 1:
+            raise ValueError("mean must be 1 dimensional")
+        if cov.shape != (mean.shape[0], mean.shape[0]):
+            raise ValueError(
+                "mean and cov must have same length and cov must be 2 "
+                "dimensional and square"
+            )
+        shape = () if size is None else _shape_of(size)
+        z = self.standard_normal(shape + mean.shape)
+        factor = cholesky(cov)
+        return mean + z @ factor.T
+
+
+def default_rng(
+    seed: Union[
+        int, Sequence[int], np.random.SeedSequence, BitGenerator, Generator
+    ] = None,
+) -> Generator:
+    """
+    Construct a new Generator with a Philox bit generator.
+
+    Parameters
+    ----------
+    seed : None, int, array_like[ints], SeedSequence, BitGenerator, Generator
+        The seed of the bit generator. A BitGenerator is wrapped in a new
+        Generator and a Generator is returned unaltered.
+
+    See Also
+    --------
+    numpy.random.default_rng
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    if isinstance(seed, Generator):
+        return seed
+    if isinstance(seed, BitGenerator):
+        return Generator(seed)
+    return Generator(Philox(seed))
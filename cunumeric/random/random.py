@@ -19,16 +19,25 @@ from typing import TYPE_CHECKING, Any, Union
 import numpy as np
 import numpy.random as nprandom
 from cunumeric.array import ndarray
+from cunumeric.random.generator import Generator, Philox
 from cunumeric.runtime import runtime
 
 if TYPE_CHECKING:
     import numpy.typing as npt
 
+# The legacy functions implemented on top of the counter-based generator
+# draw from a generator seeded with the seed. Its key is derived through a
+# SeedSequence, so that it differs from the key (seed, 0) with which the
+# other legacy functions draw from counter 0.
+_generator = Generator(Philox(0))
+
 
 def seed(init: Union[int, None] = None) -> None:
+    global _generator
     if init is None:
         init = 0
     runtime.set_next_random_epoch(int(init))
+    _generator = Generator(Philox(int(init)))
 
 
 def rand(*shapeargs: int) -> Union[float, ndarray]:
@@ -193,3 +202,53 @@ def random(shape: Union[tuple[int], None] = None) -> Union[float, ndarray]:
     result = ndarray(shape, dtype=np.dtype(np.float64))
     result._thunk.random_uniform()
     return result
+
+
+def permutation(x: Union[int, npt.ArrayLike]) -> ndarray:
+    """
+    Randomly permute a sequence, or return a permuted range.
+
+    See Also
+    --------
+    numpy.random.permutation
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    return _generator.permutation(x)
+
+
+def shuffle(x: ndarray) -> None:
+    """
+    Modify a sequence in-place by shuffling its contents.
+
+    See Also
+    --------
+    numpy.random.shuffle
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    _generator.shuffle(x)
+
+
+def choice(
+    a: Union[int, npt.ArrayLike],
+    size: Union[int, tuple[int], None] = None,
+    replace: bool = True,
+    p: Union[npt.ArrayLike, None] = None,
+) -> Union[Any, ndarray]:
+    """
+    Generates a random sample from a given 1-D array.
+
+    See Also
+    --------
+    numpy.random.choice
+
+    Availability
+    --------
+    Multiple GPUs, Multiple CPUs
+    """
+    return _generator.choice(a, size=size, replace=replace, p=p)
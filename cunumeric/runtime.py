@@ -14,10 +14,14 @@
 #
 from __future__ import annotations
 
+import json
+import os
+import platform
 import struct
 import warnings
 from functools import reduce
-from typing import TYPE_CHECKING, Any, Optional, Sequence, Union
+from time import perf_counter
+from typing import TYPE_CHECKING, Any, Callable, Optional, Sequence, Union
 
 import numpy as np
 from legate.rc import ArgSpec, Argument, parse_command_args
@@ -68,6 +72,23 @@ _supported_dtypes = {
     np.complex128: ty.complex128,
 }
 
+# Operations whose cost grows faster than their output, so that NumPy
+# stays faster than a task launch for larger arrays. The eager volume of
+# these operations is the base volume times a factor. The factor is
+# calibrated once per machine configuration by timing NumPy against the
+# tasks, and is the largest tried factor at which NumPy still wins. These
+# estimates are used instead in test mode,
+# on multiple nodes, whose calibrations could disagree, and when
+# CUNUMERIC_EAGER_CACHE is set to an empty string.
+DEFAULT_EAGER_SCALES = {
+    "contract": 16,
+    "sort": 8,
+}
+
+# The factors the calibration tries, in increasing order
+EAGER_CALIBRATION_SCALES = (1, 2, 4, 8, 16, 32, 64)
+EAGER_CALIBRATION_REPEATS = 3
+
 ARGS = [
     Argument(
         "test",
@@ -87,6 +108,15 @@ ARGS = [
             help="Preload and initialize handles of all CUDA libraries (cuBLAS, cuSOLVER, etc.) used in cuNumericLoad CUDA libs early",  # noqa E501
         ),
     ),
+    Argument(
+        "benchmark-gemm",
+        ArgSpec(
+            action="store_true",
+            default=False,
+            dest="benchmark_gemm",
+            help="Pick the tile counts of tiled factorizations from GEMM throughput measured once per process at their first use, which blocks until the measurements are done",  # noqa E501
+        ),
+    ),
     Argument(
         "warn",
         ArgSpec(
@@ -154,6 +184,12 @@ class Runtime(object):
                 ty.int32,
             )
         )
+        self.num_nodes = int(
+            self.legate_context.get_tunable(
+                CuNumericTunable.NUM_NODES,
+                ty.int32,
+            )
+        )
 
         # Make sure that our CuNumericLib object knows about us so it can
         # destroy us
@@ -166,6 +202,123 @@ class Runtime(object):
         if self.num_gpus > 0 and self.args.preload_cudalibs:
             self._load_cudalibs()
 
+        self.eager_thresholds = {
+            op: self.max_eager_volume * scale
+            for op, scale in self._eager_scales().items()
+        }
+
+    def _eager_scales(self) -> dict[str, int]:
+        if (
+            self.args.test_mode
+            or self.max_eager_volume == 0
+            or self.num_nodes > 1
+        ):
+            return dict(DEFAULT_EAGER_SCALES)
+
+        # The calibrations are cached in a file, which
+        # CUNUMERIC_EAGER_CACHE can point elsewhere
+        path = os.environ.get("CUNUMERIC_EAGER_CACHE")
+        if path is None:
+            cache_home = os.environ.get(
+                "XDG_CACHE_HOME",
+                os.path.join(os.path.expanduser("~"), ".cache"),
+            )
+            path = os.path.join(cache_home, "cunumeric", "eager_scales.json")
+        if not path:
+            return dict(DEFAULT_EAGER_SCALES)
+
+        key = (
+            f"{platform.node()}:procs={self.num_procs},gpus={self.num_gpus},"
+            f"volume={self.max_eager_volume}"
+        )
+        try:
+            with open(path) as f:
+                cache = json.load(f)
+        except (OSError, ValueError):
+            cache = {}
+        if not isinstance(cache, dict):
+            cache = {}
+        scales = cache.get(key)
+        if isinstance(scales, dict) and all(
+            isinstance(scales.get(op), int) for op in DEFAULT_EAGER_SCALES
+        ):
+            return {op: scales[op] for op in DEFAULT_EAGER_SCALES}
+
+        scales = {
+            op: self._calibrate_eager_scale(op) for op in DEFAULT_EAGER_SCALES
+        }
+        cache[key] = scales
+        # Write through a temporary file, so that concurrent processes never
+        # read a partial cache
+        try:
+            os.makedirs(os.path.dirname(path) or ".", exist_ok=True)
+            tmp_path = f"{path}.{os.getpid()}"
+            with open(tmp_path, "w") as f:
+                json.dump(cache, f, indent=2)
+            os.replace(tmp_path, path)
+        except OSError:
+            pass
+        return scales
+
+    def _calibrate_eager_scale(self, op: str) -> int:
+        scale = 1
+        for candidate in EAGER_CALIBRATION_SCALES:
+            volume = self.max_eager_volume * candidate
+            run_eager, run_deferred = self._eager_benchmark(op, volume)
+            if self._time_launches(run_eager) > self._time_launches(
+                run_deferred
+            ):
+                break
+            scale = candidate
+        return scale
+
+    def _eager_benchmark(
+        self, op: str, volume: int
+    ) -> tuple[Callable[[], Any], Callable[[], Any]]:
+        rng = np.random.default_rng(0)
+        if op == "contract":
+            n = max(int(np.sqrt(volume)), 2)
+            a = rng.random((n, n))
+            b = rng.random((n, n))
+            lhs = self.find_or_create_array_thunk(np.zeros((n, n)), defer=True)
+            rhs1 = self.find_or_create_array_thunk(a, defer=True)
+            rhs2 = self.find_or_create_array_thunk(b, defer=True)
+            mode2extent = {"a": n, "b": n, "c": n}
+
+            def run_eager() -> Any:
+                return np.matmul(a, b)
+
+            def run_deferred() -> Any:
+                return lhs.contract(
+                    ["a", "c"], rhs1, ["a", "b"], rhs2, ["b", "c"], mode2extent
+                )
+
+        else:
+            assert op == "sort"
+            x = rng.random(max(volume, 2))
+            rhs = self.find_or_create_array_thunk(x, defer=True)
+            out = self.find_or_create_array_thunk(
+                np.empty_like(x), defer=True
+            )
+
+            def run_eager() -> Any:
+                return np.sort(x)
+
+            def run_deferred() -> Any:
+                return out.sort(rhs)
+
+        return run_eager, run_deferred
+
+    def _time_launches(self, run: Callable[[], Any]) -> float:
+        # The first launch also creates the instances, so it isn't timed
+        run()
+        self.legate_runtime.issue_execution_fence(block=True)
+        start = perf_counter()
+        for _ in range(EAGER_CALIBRATION_REPEATS):
+            run()
+        self.legate_runtime.issue_execution_fence(block=True)
+        return perf_counter() - start
+
     def _register_dtypes(self) -> None:
         type_system = self.legate_context.type_system
         for numpy_type, core_type in _supported_dtypes.items():
@@ -301,6 +454,9 @@ class Runtime(object):
         else:
             return np.dtype(dtype) in self.legate_context.type_system
 
+    def get_core_type(self, dtype: np.dtype[Any]) -> Any:
+        return _supported_dtypes[dtype.type]
+
     def get_numpy_thunk(
         self,
         obj: Any,
@@ -493,11 +649,12 @@ class Runtime(object):
         shape: NdShapeLike,
         dtype: np.dtype[Any],
         inputs: Optional[Sequence[NumPyThunk]] = None,
+        op: Optional[str] = None,
     ) -> NumPyThunk:
         computed_shape = (shape,) if isinstance(shape, int) else shape
         if self.is_supported_type(dtype) and not (
-            self.is_eager_shape(computed_shape)
-            and self.are_all_eager_inputs(inputs)
+            self.is_eager_shape(computed_shape, op)
+            and self.are_all_eager_inputs(inputs, op)
         ):
             store = self.legate_context.create_store(
                 dtype, shape=computed_shape, optimize_scalar=True
@@ -512,7 +669,12 @@ class Runtime(object):
         store = self.legate_context.create_store(dtype, ndim=ndim)
         return DeferredArray(self, store, dtype=dtype)
 
-    def is_eager_shape(self, shape: NdShape) -> bool:
+    def eager_threshold(self, op: Optional[str] = None) -> int:
+        if op is None:
+            return self.max_eager_volume
+        return self.eager_thresholds.get(op, self.max_eager_volume)
+
+    def is_eager_shape(self, shape: NdShape, op: Optional[str] = None) -> bool:
         volume = calculate_volume(shape)
         # Newly created empty arrays are ALWAYS eager
         if volume == 0:
@@ -522,19 +684,31 @@ class Runtime(object):
             return False
         if len(shape) > LEGATE_MAX_DIM:
             return True
+        threshold = self.eager_threshold(op)
         if len(shape) == 0:
-            return self.max_eager_volume > 0
+            return threshold > 0
         # See if the volume is large enough
-        return volume <= self.max_eager_volume
+        return volume <= threshold
 
-    @staticmethod
-    def are_all_eager_inputs(inputs: Optional[Sequence[NumPyThunk]]) -> bool:
+    def are_all_eager_inputs(
+        self,
+        inputs: Optional[Sequence[NumPyThunk]],
+        op: Optional[str] = None,
+    ) -> bool:
         if inputs is None:
             return True
         for inp in inputs:
             assert isinstance(inp, NumPyThunk)
             if not isinstance(inp, EagerArray):
                 return False
+            # Inputs that were already converted have their data in Legion
+            if inp.deferred is not None:
+                return False
+            # Another operation may have kept an input eager that is too
+            # large for this one, in which case it's better to move it now
+            # than to keep paying NumPy's cost for it
+            if not self.is_eager_shape(inp.shape, op):
+                return False
         return True
 
     @staticmethod
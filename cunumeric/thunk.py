@@ -137,6 +137,10 @@ class NumPyThunk(ABC):
     def flip(self, rhs, axes):
         ...
 
+    @abstractmethod
+    def concatenate(self, inputs, axis, offsets):
+        ...
+
     @abstractmethod
     def contract(
         self,
@@ -205,6 +209,10 @@ class NumPyThunk(ABC):
     def random_integer(self, low, high) -> None:
         ...
 
+    @abstractmethod
+    def random_distribution(self, gen_code, key, counter, args) -> None:
+        ...
+
     @abstractmethod
     def sort(
         self, rhs, argsort=False, axis=-1, kind="quicksort", order=None
@@ -250,6 +258,22 @@ class NumPyThunk(ABC):
     def cholesky(self, src, no_tril) -> None:
         ...
 
+    @abstractmethod
+    def solve(self, a, b) -> None:
+        ...
+
+    @abstractmethod
+    def qr(self, a, q=None, b=None) -> None:
+        ...
+
+    @abstractmethod
+    def eigh(self, a, v=None, lower=True) -> None:
+        ...
+
+    @abstractmethod
+    def svd(self, a, u=None, vh=None, full_matrices=False) -> None:
+        ...
+
     @abstractmethod
     def unique(self):
         ...
@@ -257,3 +281,19 @@ class NumPyThunk(ABC):
     @abstractmethod
     def create_window(self, op_code, *args) -> None:
         ...
+
+    @abstractmethod
+    def load_npy(self, path, offset, fortran_order) -> None:
+        ...
+
+    @abstractmethod
+    def save_npy(self, path, offset) -> None:
+        ...
+
+    @abstractmethod
+    def load_chunks(self, path, chunks, level, shuffle) -> None:
+        ...
+
+    @abstractmethod
+    def save_chunks(self, path, chunks, level, shuffle) -> None:
+        ...
@@ -30,15 +30,28 @@ GEN_CPU_SRC += cunumeric/ternary/where.cc               \
 							 cunumeric/index/choose.cc                \
 							 cunumeric/index/repeat.cc                \
 							 cunumeric/index/zip.cc                   \
+							 cunumeric/io/chunks.cc                   \
+							 cunumeric/io/file.cc                     \
+							 cunumeric/io/load_chunks.cc              \
+							 cunumeric/io/load_npy.cc                 \
+							 cunumeric/io/load_text.cc                \
+							 cunumeric/io/save_chunks.cc              \
+							 cunumeric/io/save_npy.cc                 \
 							 cunumeric/item/read.cc                   \
 							 cunumeric/item/write.cc                  \
 							 cunumeric/matrix/contract.cc             \
 							 cunumeric/matrix/diag.cc                 \
 							 cunumeric/matrix/gemm.cc                 \
+							 cunumeric/matrix/geqrf.cc                \
+							 cunumeric/matrix/gesvd.cc                \
+							 cunumeric/matrix/getrf.cc                \
+							 cunumeric/matrix/getrs.cc                \
 							 cunumeric/matrix/matmul.cc               \
 							 cunumeric/matrix/matvecmul.cc            \
+							 cunumeric/matrix/batched_matmul.cc       \
 							 cunumeric/matrix/dot.cc                  \
 							 cunumeric/matrix/potrf.cc                \
+							 cunumeric/matrix/syevd.cc                \
 							 cunumeric/matrix/syrk.cc                 \
 							 cunumeric/matrix/tile.cc                 \
 							 cunumeric/matrix/transpose.cc            \
@@ -51,8 +64,11 @@ GEN_CPU_SRC += cunumeric/ternary/where.cc               \
 							 cunumeric/set/unique_reduce.cc           \
 							 cunumeric/stat/bincount.cc               \
 							 cunumeric/convolution/convolve.cc        \
+							 cunumeric/transform/concatenate.cc       \
 							 cunumeric/transform/flip.cc              \
 							 cunumeric/arg.cc                         \
+							 cunumeric/cost_model.cc                  \
+							 cunumeric/utilities/scratch_arena.cc     \
 							 cunumeric/mapper.cc
 
 GEN_CPU_SRC += cunumeric/cephes/chbevl.cc \
@@ -74,13 +90,24 @@ GEN_CPU_SRC += cunumeric/ternary/where_omp.cc          \
 							 cunumeric/index/choose_omp.cc           \
 							 cunumeric/index/repeat_omp.cc           \
 							 cunumeric/index/zip_omp.cc              \
+							 cunumeric/io/load_chunks_omp.cc         \
+							 cunumeric/io/load_npy_omp.cc            \
+							 cunumeric/io/load_text_omp.cc           \
+							 cunumeric/io/save_chunks_omp.cc         \
+							 cunumeric/io/save_npy_omp.cc            \
 							 cunumeric/matrix/contract_omp.cc        \
 							 cunumeric/matrix/diag_omp.cc            \
 							 cunumeric/matrix/gemm_omp.cc            \
+							 cunumeric/matrix/geqrf_omp.cc           \
+							 cunumeric/matrix/gesvd_omp.cc           \
+							 cunumeric/matrix/getrf_omp.cc           \
+							 cunumeric/matrix/getrs_omp.cc           \
 							 cunumeric/matrix/matmul_omp.cc          \
 							 cunumeric/matrix/matvecmul_omp.cc       \
+							 cunumeric/matrix/batched_matmul_omp.cc  \
 							 cunumeric/matrix/dot_omp.cc             \
 							 cunumeric/matrix/potrf_omp.cc           \
+							 cunumeric/matrix/syevd_omp.cc           \
 							 cunumeric/matrix/syrk_omp.cc            \
 							 cunumeric/matrix/tile_omp.cc            \
 							 cunumeric/matrix/transpose_omp.cc       \
@@ -92,6 +119,7 @@ GEN_CPU_SRC += cunumeric/ternary/where_omp.cc          \
 							 cunumeric/set/unique_omp.cc             \
 							 cunumeric/stat/bincount_omp.cc          \
 							 cunumeric/convolution/convolve_omp.cc   \
+							 cunumeric/transform/concatenate_omp.cc  \
 							 cunumeric/transform/flip_omp.cc
 endif
 
@@ -115,10 +143,16 @@ GEN_GPU_SRC += cunumeric/ternary/where.cu               \
 							 cunumeric/matrix/contract.cu             \
 							 cunumeric/matrix/diag.cu                 \
 							 cunumeric/matrix/gemm.cu                 \
+							 cunumeric/matrix/geqrf.cu                \
+							 cunumeric/matrix/gesvd.cu                \
+							 cunumeric/matrix/getrf.cu                \
+							 cunumeric/matrix/getrs.cu                \
 							 cunumeric/matrix/matmul.cu               \
 							 cunumeric/matrix/matvecmul.cu            \
+							 cunumeric/matrix/batched_matmul.cu       \
 							 cunumeric/matrix/dot.cu                  \
 							 cunumeric/matrix/potrf.cu                \
+							 cunumeric/matrix/syevd.cu                \
 							 cunumeric/matrix/syrk.cu                 \
 							 cunumeric/matrix/tile.cu                 \
 							 cunumeric/matrix/transpose.cu            \
@@ -130,6 +164,7 @@ GEN_GPU_SRC += cunumeric/ternary/where.cu               \
 							 cunumeric/stat/bincount.cu               \
 							 cunumeric/convolution/convolve.cu        \
 							 cunumeric/fft/fft.cu                     \
+							 cunumeric/transform/concatenate.cu       \
 							 cunumeric/transform/flip.cu              \
 							 cunumeric/cudalibs.cu                    \
 							 cunumeric/cunumeric.cu
@@ -0,0 +1,185 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/cost_model.h"
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iterator>
+#include <tuple>
+
+using namespace legate;
+using namespace legate::mapping;
+
+namespace cunumeric {
+
+namespace  // unnamed
+{
+// Launch overheads in microseconds, including the synchronization of a GPU task's stream
+double launch_overhead(TaskTarget target)
+{
+  switch (target) {
+    case TaskTarget::GPU: return 30.0;
+    case TaskTarget::OMP: return 15.0;
+    case TaskTarget::CPU: return 3.0;
+  }
+  return 0.0;
+}
+
+// Initial per-element costs in microseconds, until the task has been measured
+double default_usecs_per_element(TaskTarget target)
+{
+  switch (target) {
+    case TaskTarget::GPU: return 1e-5;
+    case TaskTarget::OMP: return 1e-4;
+    case TaskTarget::CPU: return 1e-3;
+  }
+  return 0.0;
+}
+
+int32_t log2_bucket(size_t volume)
+{
+  int32_t bucket = 0;
+  while (volume > 1) {
+    volume >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+}  // namespace
+
+bool CostModel::Key::operator<(const Key& other) const
+{
+  return std::tie(task_id, target, code, bucket) <
+         std::tie(other.task_id, other.target, other.code, other.bucket);
+}
+
+/*static*/ CostModel::Key CostModel::make_key(int64_t task_id,
+                                              TaskTarget target,
+                                              LegateTypeCode code,
+                                              size_t volume)
+{
+  return Key{
+    task_id, static_cast<int32_t>(target), static_cast<int32_t>(code), log2_bucket(volume)};
+}
+
+const CostModel::Estimate* CostModel::find_nearest(const Key& key) const
+{
+  // Use the closest volume measured for the same task, processor kind and type
+  auto same_config = [&](const Key& other) {
+    return other.task_id == key.task_id && other.target == key.target && other.code == key.code;
+  };
+  auto above = estimates.lower_bound(key);
+  if (above != estimates.end() && same_config(above->first) && above->first.bucket == key.bucket)
+    return &above->second;
+
+  const Estimate* nearest = nullptr;
+  int32_t distance        = INT32_MAX;
+  if (above != estimates.end() && same_config(above->first)) {
+    nearest  = &above->second;
+    distance = above->first.bucket - key.bucket;
+  }
+  if (above != estimates.begin()) {
+    auto below = std::prev(above);
+    if (same_config(below->first) && key.bucket - below->first.bucket < distance)
+      nearest = &below->second;
+  }
+  return nearest;
+}
+
+double CostModel::predict(int64_t task_id,
+                          TaskTarget target,
+                          LegateTypeCode code,
+                          size_t volume) const
+{
+  std::lock_guard<std::mutex> guard(lock);
+  auto estimate      = find_nearest(make_key(task_id, target, code, volume));
+  double per_element = estimate != nullptr ? estimate->usecs_per_element
+                                           : default_usecs_per_element(target);
+  return launch_overhead(target) + per_element * volume;
+}
+
+bool CostModel::measured(int64_t task_id,
+                         TaskTarget target,
+                         LegateTypeCode code,
+                         size_t volume) const
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return estimates.find(make_key(task_id, target, code, volume)) != estimates.end();
+}
+
+bool CostModel::needs_samples(int64_t task_id,
+                              TaskTarget target,
+                              LegateTypeCode code,
+                              size_t volume) const
+{
+  std::lock_guard<std::mutex> guard(lock);
+  auto finder = estimates.find(make_key(task_id, target, code, volume));
+  return finder == estimates.end() || finder->second.num_samples < MAX_SAMPLES;
+}
+
+void CostModel::record(
+  int64_t task_id, TaskTarget target, LegateTypeCode code, size_t volume, double usecs)
+{
+  if (volume == 0) return;
+  double sample = std::max(usecs - launch_overhead(target), 0.0) / volume;
+
+  std::lock_guard<std::mutex> guard(lock);
+  auto key    = make_key(task_id, target, code, volume);
+  auto finder = estimates.find(key);
+  if (finder == estimates.end()) {
+    estimates[key] = Estimate{sample, 1};
+    return;
+  }
+  // Running average over the first samples; a calibrated estimate counts as one sample
+  auto& estimate = finder->second;
+  if (estimate.num_samples >= MAX_SAMPLES) return;
+  estimate.usecs_per_element =
+    (estimate.usecs_per_element * estimate.num_samples + sample) / (estimate.num_samples + 1);
+  ++estimate.num_samples;
+}
+
+// The file has one estimate per line: task id, processor kind, type code, volume bucket,
+// microseconds per element and number of samples
+void CostModel::load(const std::string& filename)
+{
+  std::ifstream in(filename);
+  if (!in) return;
+
+  std::lock_guard<std::mutex> guard(lock);
+  Key key;
+  double usecs_per_element;
+  uint32_t num_samples;
+  while (in >> key.task_id >> key.target >> key.code >> key.bucket >> usecs_per_element >>
+         num_samples)
+    // Calibrated estimates are refined further, so don't count their samples
+    estimates[key] = Estimate{usecs_per_element, std::min(num_samples, 1u)};
+}
+
+void CostModel::save(const std::string& filename) const
+{
+  std::ofstream out(filename);
+  if (!out) return;
+
+  std::lock_guard<std::mutex> guard(lock);
+  for (auto& [key, estimate] : estimates)
+    out << key.task_id << " " << key.target << " " << key.code << " " << key.bucket << " "
+        << estimate.usecs_per_element << " " << estimate.num_samples << "\n";
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,92 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "cunumeric/cunumeric.h"
+#include "core/mapping/mapping.h"
+
+namespace cunumeric {
+
+// Predicts how long a task takes on each kind of processor, so that the mapper can send launches
+// that are too small to amortize the GPU or OpenMP overheads to a single CPU core. A prediction is
+// a fixed overhead per processor kind plus a cost per element. The built-in overheads and default
+// costs are rough guesses rather than calibrated values, which is why the mapper only uses the
+// model when CUNUMERIC_USE_COST_MODEL is set. The per-element costs are kept for
+// each task, processor kind, type and power-of-two volume. They start from built-in defaults or
+// from a file written by an earlier (calibration) run, and are refined with the measured
+// durations of the tasks that run.
+class CostModel {
+ public:
+  // Stop measuring a configuration after this many samples, as profiling isn't free
+  static constexpr uint32_t MAX_SAMPLES = 16;
+
+ public:
+  // Returns the predicted execution time in microseconds
+  double predict(int64_t task_id,
+                 legate::mapping::TaskTarget target,
+                 legate::LegateTypeCode code,
+                 size_t volume) const;
+  // Returns true if the configuration has an estimate of its own, measured or loaded from a file
+  bool measured(int64_t task_id,
+                legate::mapping::TaskTarget target,
+                legate::LegateTypeCode code,
+                size_t volume) const;
+  bool needs_samples(int64_t task_id,
+                     legate::mapping::TaskTarget target,
+                     legate::LegateTypeCode code,
+                     size_t volume) const;
+  void record(int64_t task_id,
+              legate::mapping::TaskTarget target,
+              legate::LegateTypeCode code,
+              size_t volume,
+              double usecs);
+
+ public:
+  void load(const std::string& filename);
+  void save(const std::string& filename) const;
+
+ private:
+  struct Key {
+    int64_t task_id;
+    int32_t target;
+    int32_t code;
+    int32_t bucket;
+
+    bool operator<(const Key& other) const;
+  };
+
+  struct Estimate {
+    double usecs_per_element;
+    uint32_t num_samples;
+  };
+
+  static Key make_key(int64_t task_id,
+                      legate::mapping::TaskTarget target,
+                      legate::LegateTypeCode code,
+                      size_t volume);
+  const Estimate* find_nearest(const Key& key) const;
+
+ private:
+  mutable std::mutex lock;
+  std::map<Key, Estimate> estimates;
+};
+
+}  // namespace cunumeric
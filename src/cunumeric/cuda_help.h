@@ -84,6 +84,36 @@ struct cufftPlan {
   size_t workarea_size;
 };
 
+// Describes a (possibly batched) cuFFT plan. Two plans with equal parameters of the same
+// cufftType are interchangeable, so this is what the plan caches are keyed on.
+struct cufftPlanParams {
+  // Basic data layout of a single, unbatched transform of the given size
+  cufftPlanParams(const Legion::DomainPoint& size);
+  // Advanced data layout; see cufftMakePlanMany64 for the meaning of each argument
+  cufftPlanParams(int rank,
+                  long long int* n,
+                  long long int* inembed,
+                  long long int istride,
+                  long long int idist,
+                  long long int* onembed,
+                  long long int ostride,
+                  long long int odist,
+                  long long int batch);
+
+  bool operator==(const cufftPlanParams& other) const;
+  std::string to_string() const;
+
+  int rank;
+  long long int n[LEGION_MAX_DIM]       = {0};
+  long long int inembed[LEGION_MAX_DIM] = {0};
+  long long int onembed[LEGION_MAX_DIM] = {0};
+  long long int istride{1};
+  long long int idist{1};
+  long long int ostride{1};
+  long long int odist{1};
+  long long int batch{1};
+};
+
 class cufftContext {
  public:
   cufftContext(cufftPlan* plan);
@@ -114,7 +144,7 @@ legate::cuda::StreamView get_cached_stream();
 cublasHandle_t get_cublas();
 cusolverDnHandle_t get_cusolver();
 cutensorHandle_t* get_cutensor();
-cufftContext get_cufft_plan(cufftType type, const Legion::DomainPoint& size);
+cufftContext get_cufft_plan(cufftType type, const cufftPlanParams& params);
 
 __host__ inline void check_cublas(cublasStatus_t status, const char* file, int line)
 {
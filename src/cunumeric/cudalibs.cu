@@ -19,6 +19,9 @@
 #include "cudalibs.h"
 
 #include <stdio.h>
+#include <algorithm>
+#include <list>
+#include <sstream>
 
 namespace cunumeric {
 
@@ -45,114 +48,151 @@ void cufftContext::setCallback(cufftXtCallbackType type, void* callback, void* d
   CHECK_CUFFT(cufftXtSetCallback(handle(), callbacks, type, datas));
 }
 
-struct cufftPlanCache {
- private:
-  // Maximum number of plans to keep per dimension
-  static constexpr int32_t MAX_PLANS = 4;
+cufftPlanParams::cufftPlanParams(const DomainPoint& size) : rank(size.dim)
+{
+  for (int dim = 0; dim < rank; ++dim) n[dim] = size[dim];
+}
+
+cufftPlanParams::cufftPlanParams(int rank,
+                                 long long int* n_,
+                                 long long int* inembed_,
+                                 long long int istride,
+                                 long long int idist,
+                                 long long int* onembed_,
+                                 long long int ostride,
+                                 long long int odist,
+                                 long long int batch)
+  : rank(rank), istride(istride), idist(idist), ostride(ostride), odist(odist), batch(batch)
+{
+  for (int dim = 0; dim < rank; ++dim) {
+    n[dim]       = n_[dim];
+    inembed[dim] = inembed_[dim];
+    onembed[dim] = onembed_[dim];
+  }
+}
 
+bool cufftPlanParams::operator==(const cufftPlanParams& other) const
+{
+  bool equal = rank == other.rank && istride == other.istride && idist == other.idist &&
+               ostride == other.ostride && odist == other.odist && batch == other.batch;
+  if (equal)
+    for (int dim = 0; dim < rank; ++dim) {
+      equal = equal && (n[dim] == other.n[dim]);
+      equal = equal && (inembed[dim] == other.inembed[dim]);
+      equal = equal && (onembed[dim] == other.onembed[dim]);
+      if (!equal) break;
+    }
+  return equal;
+}
+
+std::string cufftPlanParams::to_string() const
+{
+  std::ostringstream ss;
+  ss << "cufftPlanParams[rank(" << rank << "), n(" << n[0];
+  for (int i = 1; i < rank; ++i) ss << "," << n[i];
+  ss << "), inembed(" << inembed[0];
+  for (int i = 1; i < rank; ++i) ss << "," << inembed[i];
+  ss << "), istride(" << istride << "), idist(" << idist << "), onembed(" << onembed[0];
+  for (int i = 1; i < rank; ++i) ss << "," << onembed[i];
+  ss << "), ostride(" << ostride << "), odist(" << odist << "), batch(" << batch << ")]";
+  return ss.str();
+}
+
+struct cufftPlanCache {
  private:
   struct LRUEntry {
     std::unique_ptr<cufftPlan> plan{nullptr};
-    DomainPoint fftshape{};
-    uint32_t lru_index{0};
+    cufftPlanParams params;
   };
 
  public:
-  cufftPlanCache(cufftType type);
+  cufftPlanCache(cufftType type, size_t max_plans, size_t max_workarea_size);
   ~cufftPlanCache();
 
  public:
-  cufftPlan* get_cufft_plan(const DomainPoint& size);
+  cufftPlan* get_cufft_plan(const cufftPlanParams& params);
 
  private:
-  using Cache = std::array<LRUEntry, MAX_PLANS>;
-  std::array<Cache, LEGION_MAX_DIM + 1> cache_{};
+  void evict(const LRUEntry& entry);
+
+ private:
+  // The most recently used plan is at the front
+  std::list<LRUEntry> cache_{};
   cufftType type_;
+  // Upper bounds on the number of cached plans and on the sum of their work areas.
+  // A zero bound means the cache is unbounded in that dimension.
+  size_t max_plans_;
+  size_t max_workarea_size_;
+  size_t workarea_size_{0};
 };
 
-cufftPlanCache::cufftPlanCache(cufftType type) : type_(type)
+cufftPlanCache::cufftPlanCache(cufftType type, size_t max_plans, size_t max_workarea_size)
+  : type_(type), max_plans_(max_plans), max_workarea_size_(max_workarea_size)
 {
-  for (auto& cache : cache_)
-    for (auto& entry : cache) assert(0 == entry.fftshape.dim);
 }
 
 cufftPlanCache::~cufftPlanCache()
 {
-  for (auto& cache : cache_)
-    for (auto& entry : cache)
-      if (entry.plan != nullptr) CHECK_CUFFT(cufftDestroy(entry.plan->handle));
+  for (auto& entry : cache_) CHECK_CUFFT(cufftDestroy(entry.plan->handle));
 }
 
-cufftPlan* cufftPlanCache::get_cufft_plan(const DomainPoint& size)
+void cufftPlanCache::evict(const LRUEntry& entry)
 {
-  int32_t match = -1;
-  auto& cache   = cache_[size.dim];
-  for (int32_t idx = 0; idx < MAX_PLANS; ++idx)
-    if (cache[idx].fftshape == size) {
-      match = idx;
-      break;
-    }
+  log_cudalibs.debug() << "[cufftPlanCache] evict entry for " << entry.params.to_string()
+                       << " (type: " << type_ << ")";
+  CHECK_CUFFT(cufftDestroy(entry.plan->handle));
+  workarea_size_ -= entry.plan->workarea_size;
+}
 
-  cufftPlan* result{nullptr};
-  // If there's no match, we create a new plan
-  if (-1 == match) {
-    log_cudalibs.debug() << "[cufftPlanCache] no match found for " << size << " (type: " << type_
-                         << ")";
-    int32_t plan_index = -1;
-    for (int32_t idx = 0; idx < MAX_PLANS; ++idx) {
-      auto& entry = cache[idx];
-      if (nullptr == entry.plan) {
-        log_cudalibs.debug() << "[cufftPlanCache] found empty entry " << idx << " (type: " << type_
-                             << ")";
-        entry.plan      = std::make_unique<cufftPlan>();
-        entry.lru_index = idx;
-        plan_index      = idx;
-        break;
-      } else if (entry.lru_index == MAX_PLANS - 1) {
-        log_cudalibs.debug() << "[cufftPlanCache] evict entry " << idx << " for " << entry.fftshape
-                             << " (type: " << type_ << ")";
-        CHECK_CUFFT(cufftDestroy(entry.plan->handle));
-        plan_index = idx;
-        break;
-      }
-    }
-    assert(plan_index != -1);
-    auto& entry    = cache[plan_index];
-    entry.fftshape = size;
-    result         = entry.plan.get();
-
-    CHECK_CUFFT(cufftCreate(&result->handle));
-    CHECK_CUFFT(cufftSetAutoAllocation(result->handle, 0 /*we'll do the allocation*/));
-
-    std::vector<int32_t> n(size.dim);
-    for (int32_t dim = 0; dim < size.dim; ++dim) n[dim] = size[dim];
-    CHECK_CUFFT(cufftMakePlanMany(result->handle,
-                                  size.dim,
-                                  n.data(),
-                                  nullptr,
-                                  1,
-                                  1,
-                                  nullptr,
-                                  1,
-                                  1,
-                                  type_,
-                                  1 /*batch*/,
-                                  &result->workarea_size));
+cufftPlan* cufftPlanCache::get_cufft_plan(const cufftPlanParams& params)
+{
+  auto finder = std::find_if(
+    cache_.begin(), cache_.end(), [&params](const auto& entry) { return entry.params == params; });
+
+  // If there's a match, we return the cached plan after moving it to the front
+  if (finder != cache_.end()) {
+    log_cudalibs.debug() << "[cufftPlanCache] found match for " << params.to_string()
+                         << " (type: " << type_ << ")";
+    cache_.splice(cache_.begin(), cache_, finder);
+    return cache_.front().plan.get();
   }
-  // Otherwise, we return the cached plan and adjust the LRU count
-  else {
-    log_cudalibs.debug() << "[cufftPlanCache] found match for " << size << " (type: " << type_
-                         << ")";
-    auto& entry = cache[match];
-    result      = entry.plan.get();
-
-    for (int32_t idx = 0; idx < MAX_PLANS; ++idx) {
-      auto& other = cache[idx];
-      if (other.lru_index < entry.lru_index) ++other.lru_index;
-    }
-    entry.lru_index = 0;
+
+  // Otherwise, we create a new plan
+  log_cudalibs.debug() << "[cufftPlanCache] no match found for " << params.to_string()
+                       << " (type: " << type_ << ")";
+
+  auto plan = std::make_unique<cufftPlan>();
+  CHECK_CUFFT(cufftCreate(&plan->handle));
+  CHECK_CUFFT(cufftSetAutoAllocation(plan->handle, 0 /*we'll do the allocation*/));
+
+  // An all-zero embedding selects the basic data layout
+  auto inembed = params.inembed[0] == 0 ? nullptr : const_cast<long long int*>(params.inembed);
+  auto onembed = params.onembed[0] == 0 ? nullptr : const_cast<long long int*>(params.onembed);
+  CHECK_CUFFT(cufftMakePlanMany64(plan->handle,
+                                  params.rank,
+                                  const_cast<long long int*>(params.n),
+                                  inembed,
+                                  params.istride,
+                                  params.idist,
+                                  onembed,
+                                  params.ostride,
+                                  params.odist,
+                                  type_,
+                                  params.batch,
+                                  &plan->workarea_size));
+
+  workarea_size_ += plan->workarea_size;
+  cache_.push_front(LRUEntry{std::move(plan), params});
+
+  // Evict the least recently used plans until we are back within the bounds,
+  // but never the plan we just created
+  while (cache_.size() > 1 && ((max_plans_ > 0 && cache_.size() > max_plans_) ||
+                               (max_workarea_size_ > 0 && workarea_size_ > max_workarea_size_))) {
+    evict(cache_.back());
+    cache_.pop_back();
   }
-  return result;
+
+  return cache_.front().plan.get();
 }
 
 CUDALibraries::CUDALibraries()
@@ -168,7 +208,7 @@ void CUDALibraries::finalize()
   if (cublas_ != nullptr) finalize_cublas();
   if (cusolver_ != nullptr) finalize_cusolver();
   if (cutensor_ != nullptr) finalize_cutensor();
-  for (auto& pair : plan_caches_) delete pair.second;
+  finalize_cufft();
   finalized_ = true;
 }
 
@@ -190,6 +230,12 @@ void CUDALibraries::finalize_cutensor()
   cutensor_ = nullptr;
 }
 
+void CUDALibraries::finalize_cufft()
+{
+  for (auto& pair : plan_caches_) delete pair.second;
+  plan_caches_.clear();
+}
+
 cublasHandle_t CUDALibraries::get_cublas()
 {
   if (nullptr == cublas_) {
@@ -220,17 +266,24 @@ cutensorHandle_t* CUDALibraries::get_cutensor()
   return cutensor_;
 }
 
-cufftContext CUDALibraries::get_cufft_plan(cufftType type, const DomainPoint& size)
+cufftContext CUDALibraries::get_cufft_plan(cufftType type, const cufftPlanParams& params)
 {
   auto finder = plan_caches_.find(type);
   cufftPlanCache* cache{nullptr};
 
   if (plan_caches_.end() == finder) {
-    cache              = new cufftPlanCache(type);
+    // Maximum number of plans to keep per transform type. Tests keep only a couple, so that they
+    // exercise the eviction.
+    static const size_t max_plans =
+      static_cast<size_t>(legate::extract_env("CUNUMERIC_CUFFT_PLAN_CACHE_SIZE", 32, 2));
+    // Maximum total work area of the plans kept per transform type, in MiB
+    static const size_t max_workarea_size =
+      static_cast<size_t>(legate::extract_env("CUNUMERIC_CUFFT_PLAN_CACHE_WORKAREA", 0, 0)) << 20;
+    cache              = new cufftPlanCache(type, max_plans, max_workarea_size);
     plan_caches_[type] = cache;
   } else
     cache = finder->second;
-  return cufftContext(cache->get_cufft_plan(size));
+  return cufftContext(cache->get_cufft_plan(params));
 }
 
 static CUDALibraries& get_cuda_libraries(Processor proc)
@@ -271,11 +324,11 @@ cutensorHandle_t* get_cutensor()
   return lib.get_cutensor();
 }
 
-cufftContext get_cufft_plan(cufftType type, const Legion::DomainPoint& size)
+cufftContext get_cufft_plan(cufftType type, const cufftPlanParams& params)
 {
   const auto proc = Processor::get_executing_processor();
   auto& lib       = get_cuda_libraries(proc);
-  return lib.get_cufft_plan(type, size);
+  return lib.get_cufft_plan(type, params);
 }
 
 class LoadCUDALibsTask : public CuNumericTask<LoadCUDALibsTask> {
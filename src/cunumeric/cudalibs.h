@@ -37,12 +37,13 @@ struct CUDALibraries {
   cublasHandle_t get_cublas();
   cusolverDnHandle_t get_cusolver();
   cutensorHandle_t* get_cutensor();
-  cufftContext get_cufft_plan(cufftType type, const Legion::DomainPoint& size);
+  cufftContext get_cufft_plan(cufftType type, const cufftPlanParams& params);
 
  private:
   void finalize_cublas();
   void finalize_cusolver();
   void finalize_cutensor();
+  void finalize_cufft();
 
  private:
   bool finalized_;
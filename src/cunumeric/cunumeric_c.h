@@ -29,10 +29,12 @@ enum CuNumericOpCode {
   _CUNUMERIC_OP_CODE_BASE = 0,
   CUNUMERIC_ADVANCED_INDEXING,
   CUNUMERIC_ARANGE,
+  CUNUMERIC_BATCHED_MATMUL,
   CUNUMERIC_BINARY_OP,
   CUNUMERIC_BINARY_RED,
   CUNUMERIC_BINCOUNT,
   CUNUMERIC_CHOOSE,
+  CUNUMERIC_CONCATENATE,
   CUNUMERIC_CONTRACT,
   CUNUMERIC_CONVERT,
   CUNUMERIC_CONVOLVE,
@@ -43,7 +45,14 @@ enum CuNumericOpCode {
   CUNUMERIC_FILL,
   CUNUMERIC_FLIP,
   CUNUMERIC_GEMM,
+  CUNUMERIC_GEQRF,
+  CUNUMERIC_GESVD,
+  CUNUMERIC_GETRF,
+  CUNUMERIC_GETRS,
+  CUNUMERIC_LOAD_CHUNKS,
   CUNUMERIC_LOAD_CUDALIBS,
+  CUNUMERIC_LOAD_NPY,
+  CUNUMERIC_LOAD_TEXT,
   CUNUMERIC_MATMUL,
   CUNUMERIC_MATVECMUL,
   CUNUMERIC_NONZERO,
@@ -51,8 +60,11 @@ enum CuNumericOpCode {
   CUNUMERIC_RAND,
   CUNUMERIC_READ,
   CUNUMERIC_REPEAT,
+  CUNUMERIC_SAVE_CHUNKS,
+  CUNUMERIC_SAVE_NPY,
   CUNUMERIC_SCALAR_UNARY_RED,
   CUNUMERIC_SORT,
+  CUNUMERIC_SYEVD,
   CUNUMERIC_SYRK,
   CUNUMERIC_TILE,
   CUNUMERIC_TRANSPOSE_COPY_2D,
@@ -198,6 +210,7 @@ enum CuNumericTunable {
   CUNUMERIC_TUNABLE_NUM_PROCS        = 2,
   CUNUMERIC_TUNABLE_MAX_EAGER_VOLUME = 3,
   CUNUMERIC_TUNABLE_HAS_NUMAMEM      = 4,
+  CUNUMERIC_TUNABLE_NUM_NODES        = 5,
 };
 
 enum CuNumericBounds {
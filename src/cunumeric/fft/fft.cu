@@ -94,19 +94,15 @@ __host__ static inline void cufft_operation(AccessorWO<OUTPUT_TYPE, DIM> out,
     num_elements *= n[i];
   }
 
-  // Create the plan
-  cufftHandle plan;
-  CHECK_CUFFT(cufftCreate(&plan));
-  CHECK_CUFFT(cufftSetAutoAllocation(plan, 0 /*we'll do the allocation*/));
-  CHECK_CUFFT(cufftSetStream(plan, stream));
-
-  // Create the plan and allocate a temporary buffer for it if it needs one
-  CHECK_CUFFT(cufftMakePlanMany64(
-    plan, DIM, n, inembed, 1, 1, onembed, 1, 1, static_cast<cufftType>(type), 1, &workarea_size));
+  // Get the plan from the cache and allocate a temporary buffer for it if it needs one
+  auto plan = get_cufft_plan(static_cast<cufftType>(type),
+                             cufftPlanParams(DIM, n, inembed, 1, 1, onembed, 1, 1, 1));
+  CHECK_CUFFT(cufftSetStream(plan.handle(), stream));
 
+  workarea_size = plan.workareaSize();
   if (workarea_size > 0) {
     auto workarea_buffer = create_buffer<uint8_t>(workarea_size, Legion::Memory::Kind::GPU_FB_MEM);
-    CHECK_CUFFT(cufftSetWorkArea(plan, workarea_buffer.ptr(0)));
+    CHECK_CUFFT(cufftSetWorkArea(plan.handle(), workarea_buffer.ptr(0)));
   }
 
   const void* in_ptr{nullptr};
@@ -118,13 +114,12 @@ __host__ static inline void cufft_operation(AccessorWO<OUTPUT_TYPE, DIM> out,
     in_ptr = buffer.ptr(zero);
   }
   // FFT the input data
-  CHECK_CUFFT(cufftXtExec(plan,
+  CHECK_CUFFT(cufftXtExec(plan.handle(),
                           const_cast<void*>(in_ptr),
                           static_cast<void*>(out.ptr(out_rect.lo)),
                           static_cast<int32_t>(direction)));
 
-  // Clean up our resources, Buffers are cleaned up by Legion
-  CHECK_CUFFT(cufftDestroy(plan));
+  // Buffers are cleaned up by Legion and the plan stays in the cache for later calls
 }
 
 template <int32_t DIM, typename OUTPUT, typename INPUT_TYPE>
@@ -220,12 +215,6 @@ __host__ static inline void cufft_over_axes_c2c(AccessorWO<OUTPUT_TYPE, DIM> out
   Buffer<uint8_t> workarea_buffer;
   size_t last_workarea_size = 0;
   for (auto& ax : axes) {
-    // Create the plan
-    cufftHandle plan;
-    CHECK_CUFFT(cufftCreate(&plan));
-    CHECK_CUFFT(cufftSetAutoAllocation(plan, 0 /*we'll do the allocation*/));
-    CHECK_CUFFT(cufftSetStream(plan, stream));
-
     // Single axis dimensions / stridfes
     dim_t size_1d = n[ax];
     // TODO: batches only correct for DIM <= 3. Fix for N-DIM case
@@ -239,35 +228,25 @@ __host__ static inline void cufft_over_axes_c2c(AccessorWO<OUTPUT_TYPE, DIM> out
     dim_t idist = (ax == DIM - 1) ? fft_size_in[ax] : 1;
     dim_t odist = (ax == DIM - 1) ? fft_size_out[ax] : 1;
 
-    // Create the plan and allocate a temporary buffer for it if it needs one
-    CHECK_CUFFT(cufftMakePlanMany64(plan,
-                                    1,
-                                    &size_1d,
-                                    inembed,
-                                    istride,
-                                    idist,
-                                    onembed,
-                                    ostride,
-                                    odist,
-                                    (cufftType)type,
-                                    batches,
-                                    &workarea_size));
+    // Get the plan from the cache and allocate a temporary buffer for it if it needs one
+    auto plan = get_cufft_plan(
+      (cufftType)type,
+      cufftPlanParams(1, &size_1d, inembed, istride, idist, onembed, ostride, odist, batches));
+    CHECK_CUFFT(cufftSetStream(plan.handle(), stream));
 
+    workarea_size = plan.workareaSize();
     if (workarea_size > 0) {
       if (workarea_size > last_workarea_size) {
         if (last_workarea_size > 0) workarea_buffer.destroy();
         workarea_buffer = create_buffer<uint8_t>(workarea_size, Legion::Memory::Kind::GPU_FB_MEM);
         last_workarea_size = workarea_size;
       }
-      CHECK_CUFFT(cufftSetWorkArea(plan, workarea_buffer.ptr(0)));
+      CHECK_CUFFT(cufftSetWorkArea(plan.handle(), workarea_buffer.ptr(0)));
     }
 
     // TODO: following function only correct for DIM <= 3. Fix for N-DIM case
     cufft_axes_plan<DIM, Buffer<INPUT_TYPE, DIM>, INPUT_TYPE>::execute(
-      plan, input_buffer, input_buffer, out_rect, in_rect, ax, direction);
-
-    // Clean up our resources, Buffers are cleaned up by Legion
-    CHECK_CUFFT(cufftDestroy(plan));
+      plan.handle(), input_buffer, input_buffer, out_rect, in_rect, ax, direction);
   }
   CHECK_CUDA(cudaMemcpyAsync(out.ptr(zero),
                              input_buffer.ptr(zero),
@@ -314,12 +293,6 @@ __host__ static inline void cufft_over_axis_r2c_c2r(AccessorWO<OUTPUT_TYPE, DIM>
   auto input_buffer = create_buffer<INPUT_TYPE, DIM>(fft_size_in, Legion::Memory::Kind::GPU_FB_MEM);
   copy_into_buffer<DIM, INPUT_TYPE>(input_buffer, in, in_rect, num_elements_in, stream);
 
-  // Create the plan
-  cufftHandle plan;
-  CHECK_CUFFT(cufftCreate(&plan));
-  CHECK_CUFFT(cufftSetAutoAllocation(plan, 0 /*we'll do the allocation*/));
-  CHECK_CUFFT(cufftSetStream(plan, stream));
-
   // Operate over the R2C or C2R axis, which should be the only one in the list
   assert(axes.size() == 1);
   auto axis = axes.front();
@@ -338,30 +311,20 @@ __host__ static inline void cufft_over_axis_r2c_c2r(AccessorWO<OUTPUT_TYPE, DIM>
   dim_t idist = (axis == DIM - 1) ? fft_size_in[axis] : 1;
   dim_t odist = (axis == DIM - 1) ? fft_size_out[axis] : 1;
 
-  // Create the plan and allocate a temporary buffer for it if it needs one
-  CHECK_CUFFT(cufftMakePlanMany64(plan,
-                                  1,
-                                  &size_1d,
-                                  inembed,
-                                  istride,
-                                  idist,
-                                  onembed,
-                                  ostride,
-                                  odist,
-                                  (cufftType)type,
-                                  batches,
-                                  &workarea_size));
+  // Get the plan from the cache and allocate a temporary buffer for it if it needs one
+  auto plan = get_cufft_plan(
+    (cufftType)type,
+    cufftPlanParams(1, &size_1d, inembed, istride, idist, onembed, ostride, odist, batches));
+  CHECK_CUFFT(cufftSetStream(plan.handle(), stream));
 
+  workarea_size = plan.workareaSize();
   if (workarea_size > 0) {
     auto workarea_buffer = create_buffer<uint8_t>(workarea_size, Legion::Memory::Kind::GPU_FB_MEM);
-    CHECK_CUFFT(cufftSetWorkArea(plan, workarea_buffer.ptr(0)));
+    CHECK_CUFFT(cufftSetWorkArea(plan.handle(), workarea_buffer.ptr(0)));
   }
 
   cufft_axes_plan<DIM, AccessorWO<OUTPUT_TYPE, DIM>, INPUT_TYPE>::execute(
-    plan, out, input_buffer, out_rect, in_rect, axis, direction);
-
-  // Clean up our resources, Buffers are cleaned up by Legion
-  CHECK_CUFFT(cufftDestroy(plan));
+    plan.handle(), out, input_buffer, out_rect, in_rect, axis, direction);
 }
 
 template <CuNumericFFTType FFT_TYPE, LegateTypeCode CODE_OUT, LegateTypeCode CODE_IN, int32_t DIM>
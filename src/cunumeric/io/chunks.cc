@@ -0,0 +1,90 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/chunks.h"
+
+#include <cstring>
+#include <zlib.h>
+
+namespace cunumeric {
+
+static void shuffle_bytes(const char* in, char* out, size_t size, size_t elem_size)
+{
+  const size_t count = size / elem_size;
+  for (size_t byte = 0; byte < elem_size; ++byte)
+    for (size_t idx = 0; idx < count; ++idx) out[byte * count + idx] = in[idx * elem_size + byte];
+}
+
+static void unshuffle_bytes(const char* in, char* out, size_t size, size_t elem_size)
+{
+  const size_t count = size / elem_size;
+  for (size_t idx = 0; idx < count; ++idx)
+    for (size_t byte = 0; byte < elem_size; ++byte)
+      out[idx * elem_size + byte] = in[byte * count + idx];
+}
+
+ChunkCodec::ChunkCodec(size_t elem_size, int32_t level, bool shuffle)
+  : elem_size(elem_size), level(level), shuffle(shuffle && elem_size > 1)
+{
+}
+
+void ChunkCodec::encode(const char* data, size_t size, std::vector<char>& out) const
+{
+  if (shuffle) {
+    scratch.resize(size);
+    shuffle_bytes(data, scratch.data(), size, elem_size);
+    data = scratch.data();
+  }
+  if (level < 0) {
+    out.assign(data, data + size);
+    return;
+  }
+  uLongf length = compressBound(size);
+  out.resize(length);
+  auto result = compress2(reinterpret_cast<Bytef*>(out.data()),
+                          &length,
+                          reinterpret_cast<const Bytef*>(data),
+                          size,
+                          level);
+  if (result != Z_OK) throw legate::TaskException("Failed to compress a chunk");
+  out.resize(length);
+}
+
+bool ChunkCodec::decode(const char* data, size_t size, char* out, size_t out_size) const
+{
+  if (level < 0) {
+    if (size != out_size) return false;
+    if (shuffle)
+      unshuffle_bytes(data, out, size, elem_size);
+    else
+      memcpy(out, data, size);
+    return true;
+  }
+  char* target = out;
+  if (shuffle) {
+    scratch.resize(out_size);
+    target = scratch.data();
+  }
+  uLongf length = out_size;
+  auto result   = uncompress(
+    reinterpret_cast<Bytef*>(target), &length, reinterpret_cast<const Bytef*>(data), size);
+  if (result != Z_OK || length != out_size) return false;
+  if (shuffle) unshuffle_bytes(target, out, out_size, elem_size);
+  return true;
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,96 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+#include "cunumeric/pitches.h"
+
+#include <string>
+#include <vector>
+
+namespace cunumeric {
+
+// Chunks are stored as in the zarr (v2) format: each chunk is a file named after its indices in
+// the chunk grid, which holds the elements of the chunk in row-major order, padded to the full
+// chunk shape at the edges of the array. The bytes of the elements are optionally shuffled, so that
+// bytes of equal significance are adjacent, and the result is optionally compressed with zlib.
+class ChunkCodec {
+ public:
+  // A negative `level` stores chunks uncompressed
+  ChunkCodec(size_t elem_size, int32_t level, bool shuffle);
+
+ public:
+  // Replaces the contents of `out` with the encoding of `size` bytes at `data`
+  void encode(const char* data, size_t size, std::vector<char>& out) const;
+  // Decodes `size` bytes at `data` into exactly `out_size` bytes at `out`, and returns false if
+  // the data is not a valid encoding of that many bytes
+  bool decode(const char* data, size_t size, char* out, size_t out_size) const;
+
+ private:
+  size_t elem_size;
+  int32_t level;
+  bool shuffle;
+  // Holds the shuffled bytes of a chunk
+  mutable std::vector<char> scratch;
+};
+
+// The chunks that overlap the rectangle
+template <int DIM>
+Legion::Rect<DIM> chunks_of(const Legion::Rect<DIM>& rect, const Legion::Point<DIM>& chunk_shape)
+{
+  Legion::Rect<DIM> chunks;
+  for (int32_t dim = 0; dim < DIM; ++dim) {
+    chunks.lo[dim] = rect.lo[dim] / chunk_shape[dim];
+    chunks.hi[dim] = rect.hi[dim] / chunk_shape[dim];
+  }
+  return chunks;
+}
+
+// Calls f(point, offset, count) for each row of the part of the chunk that lies within the
+// rectangle, where `offset` is the position of `point` in the chunk and `count` the row length
+template <int DIM, typename F>
+void for_each_chunk_row(const Legion::Point<DIM>& chunk,
+                        const Legion::Point<DIM>& chunk_shape,
+                        const Legion::Rect<DIM>& rect,
+                        F&& f)
+{
+  const Legion::Point<DIM> lo = chunk * chunk_shape;
+  const auto bounds = Legion::Rect<DIM>(lo, lo + chunk_shape - Legion::Point<DIM>::ONES())
+                        .intersection(rect);
+
+  Pitches<DIM - 1> pitches;
+  const size_t volume = pitches.flatten(bounds);
+  const size_t run    = bounds.hi[DIM - 1] - bounds.lo[DIM - 1] + 1;
+  for (size_t idx = 0; idx < volume; idx += run) {
+    auto point    = pitches.unflatten(idx, bounds.lo);
+    size_t offset = 0;
+    for (int32_t dim = 0; dim < DIM; ++dim)
+      offset = offset * chunk_shape[dim] + point[dim] - lo[dim];
+    f(point, offset, run);
+  }
+}
+
+template <int DIM>
+std::string chunk_path(const std::string& dir, const Legion::Point<DIM>& chunk)
+{
+  std::string path = dir + "/" + std::to_string(chunk[0]);
+  for (int32_t dim = 1; dim < DIM; ++dim) path += "." + std::to_string(chunk[dim]);
+  return path;
+}
+
+}  // namespace cunumeric
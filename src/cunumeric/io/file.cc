@@ -0,0 +1,89 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/file.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cunumeric {
+
+File::File(const std::string& path, Mode mode) : path(path)
+{
+  switch (mode) {
+    case Mode::READ: fd = open(path.c_str(), O_RDONLY); break;
+    case Mode::WRITE: fd = open(path.c_str(), O_WRONLY); break;
+    case Mode::CREATE: fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666); break;
+  }
+  if (fd < 0) fail("open");
+}
+
+File::~File() { close(fd); }
+
+/*static*/ bool File::exists(const std::string& path) { return access(path.c_str(), F_OK) == 0; }
+
+size_t File::size() const
+{
+  struct stat info;
+  if (fstat(fd, &info) != 0) fail("stat");
+  return info.st_size;
+}
+
+void File::read(void* buffer, size_t size, size_t offset) const
+{
+  auto ptr = static_cast<char*>(buffer);
+  while (size > 0) {
+    ssize_t done = pread(fd, ptr, size, offset);
+    if (done < 0 && errno == EINTR) continue;
+    if (done < 0) fail("read");
+    // The file is shorter than its header says
+    if (done == 0) throw legate::TaskException("Unexpected end of file " + path);
+    ptr += done;
+    size -= done;
+    offset += done;
+  }
+}
+
+void File::write(const void* buffer, size_t size, size_t offset) const
+{
+  auto ptr = static_cast<const char*>(buffer);
+  while (size > 0) {
+    ssize_t done = pwrite(fd, ptr, size, offset);
+    if (done < 0 && errno == EINTR) continue;
+    if (done < 0) fail("write");
+    ptr += done;
+    size -= done;
+    offset += done;
+  }
+}
+
+void File::fail(const char* action) const
+{
+  throw legate::TaskException(std::string("Failed to ") + action + " " + path + ": " +
+                              strerror(errno));
+}
+
+std::string path_from_scalar(const legate::Scalar& scalar)
+{
+  auto bytes = scalar.values<uint8_t>();
+  return std::string(reinterpret_cast<const char*>(bytes.ptr()), bytes.size());
+}
+
+}  // namespace cunumeric
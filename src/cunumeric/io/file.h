@@ -0,0 +1,66 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+#include <string>
+
+namespace cunumeric {
+
+// A file opened by a task. Reads and writes take explicit offsets, so the point tasks of a launch
+// and the threads within each can access the same file at once. Failures are raised as task
+// exceptions that name the file.
+class File {
+ public:
+  enum class Mode : int {
+    READ   = 0,
+    WRITE  = 1,
+    CREATE = 2,
+  };
+
+ public:
+  File(const std::string& path, Mode mode);
+  ~File();
+
+ private:
+  File(const File&)            = delete;
+  File& operator=(const File&) = delete;
+
+ public:
+  static bool exists(const std::string& path);
+
+ public:
+  size_t size() const;
+
+  // Transfers exactly `size` bytes, starting at byte `offset` of the file
+  void read(void* buffer, size_t size, size_t offset) const;
+  void write(const void* buffer, size_t size, size_t offset) const;
+
+ private:
+  [[noreturn]] void fail(const char* action) const;
+
+ private:
+  std::string path;
+  int fd{-1};
+};
+
+// Paths are passed to tasks as tuples of bytes, because they need not be valid UTF-8
+std::string path_from_scalar(const legate::Scalar& scalar);
+
+}  // namespace cunumeric
@@ -0,0 +1,54 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/load_chunks.h"
+#include "cunumeric/io/load_chunks_template.inl"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL, int32_t DIM>
+struct LoadChunksImplBody<VariantKind::CPU, VAL, DIM> {
+  void operator()(const LoadChunksArgs& args,
+                  AccessorWO<VAL, DIM> out,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& chunk_shape,
+                  const Rect<DIM>& chunks) const
+  {
+    ChunkCodec codec(sizeof(VAL), args.level, args.shuffle);
+    std::vector<char> data, buffer;
+    for (PointInRectIterator<DIM> chunk(chunks); chunk.valid(); ++chunk)
+      load_chunk(args, codec, out, rect, chunk_shape, *chunk, data, buffer);
+  }
+};
+
+/*static*/ void LoadChunksTask::cpu_variant(TaskContext& context)
+{
+  load_chunks_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  LoadChunksTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,45 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct LoadChunksArgs {
+  const Array& out;
+  // The directory that holds the chunks
+  std::string path;
+  Legion::DomainPoint chunk_shape;
+  // The zlib compression level, or a negative value for uncompressed chunks
+  int32_t level;
+  bool shuffle;
+};
+
+class LoadChunksTask : public CuNumericTask<LoadChunksTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_LOAD_CHUNKS;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
@@ -0,0 +1,66 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/load_chunks.h"
+#include "cunumeric/io/load_chunks_template.inl"
+
+#include <exception>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL, int32_t DIM>
+struct LoadChunksImplBody<VariantKind::OMP, VAL, DIM> {
+  void operator()(const LoadChunksArgs& args,
+                  AccessorWO<VAL, DIM> out,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& chunk_shape,
+                  const Rect<DIM>& chunks) const
+  {
+    Pitches<DIM - 1> pitches;
+    const size_t num_chunks = pitches.flatten(chunks);
+
+    // Exceptions can't leave a parallel region, so the first one is rethrown after it
+    std::exception_ptr error;
+#pragma omp parallel
+    {
+      // Each thread codes its chunks with its own buffers
+      ChunkCodec codec(sizeof(VAL), args.level, args.shuffle);
+      std::vector<char> data, buffer;
+#pragma omp for schedule(dynamic)
+      for (size_t idx = 0; idx < num_chunks; ++idx) {
+        try {
+          auto chunk = pitches.unflatten(idx, chunks.lo);
+          load_chunk(args, codec, out, rect, chunk_shape, chunk, data, buffer);
+        } catch (...) {
+#pragma omp critical
+          if (!error) error = std::current_exception();
+        }
+      }
+    }
+    if (error) std::rethrow_exception(error);
+  }
+};
+
+/*static*/ void LoadChunksTask::omp_variant(TaskContext& context)
+{
+  load_chunks_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,107 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/io/load_chunks.h"
+#include "cunumeric/io/chunks.h"
+#include "cunumeric/io/file.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, typename VAL, int DIM>
+struct LoadChunksImplBody;
+
+// Reads the chunk and copies the part of it that lies within the tile, using `data` and `buffer`
+// to hold the encoded and decoded chunk
+template <typename VAL, int DIM>
+static void load_chunk(const LoadChunksArgs& args,
+                       const ChunkCodec& codec,
+                       const AccessorWO<VAL, DIM>& out,
+                       const Rect<DIM>& rect,
+                       const Point<DIM>& chunk_shape,
+                       const Point<DIM>& chunk,
+                       std::vector<char>& data,
+                       std::vector<char>& buffer)
+{
+  auto path = chunk_path(args.path, chunk);
+  if (!File::exists(path)) {
+    // Chunks that were never written hold the fill value, which is zero
+    for_each_chunk_row(chunk, chunk_shape, rect, [&](auto point, size_t offset, size_t count) {
+      std::fill_n(out.ptr(point), count, VAL{});
+    });
+    return;
+  }
+
+  File file(path, File::Mode::READ);
+  data.resize(file.size());
+  file.read(data.data(), data.size(), 0);
+
+  size_t chunk_volume = 1;
+  for (int32_t dim = 0; dim < DIM; ++dim) chunk_volume *= chunk_shape[dim];
+  buffer.resize(chunk_volume * sizeof(VAL));
+  if (!codec.decode(data.data(), data.size(), buffer.data(), buffer.size()))
+    throw legate::TaskException("Corrupt chunk " + path);
+
+  auto values = reinterpret_cast<const VAL*>(buffer.data());
+  for_each_chunk_row(chunk, chunk_shape, rect, [&](auto point, size_t offset, size_t count) {
+    memcpy(out.ptr(point), values + offset, count * sizeof(VAL));
+  });
+}
+
+template <VariantKind KIND>
+struct LoadChunksImpl {
+  template <LegateTypeCode CODE, int DIM>
+  void operator()(LoadChunksArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+    if (rect.empty()) return;
+
+    // The mapper gives the task an exact row-major instance, so every row of a chunk is
+    // contiguous in memory
+    auto out = args.out.write_accessor<VAL, DIM>(rect);
+    Point<DIM> chunk_shape(args.chunk_shape);
+
+    LoadChunksImplBody<KIND, VAL, DIM>{}(
+      args, out, rect, chunk_shape, chunks_of(rect, chunk_shape));
+  }
+};
+
+template <VariantKind KIND>
+static void load_chunks_template(TaskContext& context)
+{
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+
+  LoadChunksArgs args{outputs[0],
+                      path_from_scalar(scalars[0]),
+                      scalars[1].value<DomainPoint>(),
+                      scalars[2].value<int32_t>(),
+                      scalars[3].value<bool>()};
+  double_dispatch(args.out.dim(), args.out.code(), LoadChunksImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
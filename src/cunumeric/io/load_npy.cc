@@ -0,0 +1,66 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/load_npy.h"
+#include "cunumeric/io/load_npy_template.inl"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL, int32_t DIM>
+struct LoadNpyImplBody<VariantKind::CPU, VAL, DIM> {
+  void operator()(const File& file,
+                  AccessorWO<VAL, DIM> out,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& strides,
+                  size_t volume,
+                  size_t offset,
+                  bool dense) const
+  {
+    // Each run of the tile that is contiguous in the file takes a single read
+    const size_t run = contiguous_extent(rect, strides);
+    Buffer<VAL> staging;
+    if (!dense) staging = create_buffer<VAL>(run, Memory::Kind::SYSTEM_MEM);
+    for (size_t idx = 0; idx < volume; idx += run) {
+      auto point      = pitches.unflatten(idx, rect.lo);
+      size_t file_idx = 0;
+      for (int32_t dim = 0; dim < DIM; ++dim) file_idx += point[dim] * strides[dim];
+      if (dense) {
+        file.read(out.ptr(point), run * sizeof(VAL), offset + file_idx * sizeof(VAL));
+        continue;
+      }
+      auto ptr = staging.ptr(0);
+      file.read(ptr, run * sizeof(VAL), offset + file_idx * sizeof(VAL));
+      for (size_t i = 0; i < run; ++i) out[pitches.unflatten(idx + i, rect.lo)] = ptr[i];
+    }
+  }
+};
+
+/*static*/ void LoadNpyTask::cpu_variant(TaskContext& context)
+{
+  load_npy_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { LoadNpyTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
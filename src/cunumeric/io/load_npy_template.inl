@@ -0,0 +1,74 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/io/load_npy.h"
+#include "cunumeric/io/file.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, typename VAL, int DIM>
+struct LoadNpyImplBody;
+
+template <VariantKind KIND>
+struct LoadNpyImpl {
+  template <LegateTypeCode CODE, int DIM>
+  void operator()(LoadNpyArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.out.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    if (volume == 0) return;
+
+    // The mapper asks for a row-major instance, in which every run of elements that is contiguous
+    // in the file is also contiguous in memory. That doesn't hold when the output is a transposed
+    // view of the instance, as for files in Fortran order, and the runs are then read into a
+    // staging buffer and copied element by element.
+    auto out   = args.out.write_accessor<VAL, DIM>(rect);
+    bool dense = out.accessor.is_dense_row_major(rect);
+    Point<DIM> strides(args.strides);
+
+    File file(args.path, File::Mode::READ);
+    LoadNpyImplBody<KIND, VAL, DIM>{}(
+      file, out, pitches, rect, strides, volume, args.offset, dense);
+  }
+};
+
+template <VariantKind KIND>
+static void load_npy_template(TaskContext& context)
+{
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+
+  LoadNpyArgs args{outputs[0],
+                   path_from_scalar(scalars[0]),
+                   scalars[1].value<uint64_t>(),
+                   scalars[2].value<DomainPoint>()};
+  double_dispatch(args.out.dim(), args.out.code(), LoadNpyImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,51 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/load_text.h"
+#include "cunumeric/io/load_text_template.inl"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL>
+struct LoadTextImplBody<VariantKind::CPU, VAL> {
+  std::pair<Buffer<VAL>, size_t> operator()(const LoadTextArgs& args,
+                                            const std::vector<char>& text,
+                                            size_t offset) const
+  {
+    std::vector<VAL> values;
+    parse_lines(args, text.data(), text.data() + text.size(), offset, values);
+
+    auto result = create_buffer<VAL>(values.size(), Memory::Kind::SYSTEM_MEM);
+    std::copy(values.begin(), values.end(), result.ptr(0));
+    return {result, values.size()};
+  }
+};
+
+/*static*/ void LoadTextTask::cpu_variant(TaskContext& context)
+{
+  load_text_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { LoadTextTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
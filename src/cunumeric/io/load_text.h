@@ -0,0 +1,56 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+#include "cunumeric/cunumeric.h"
+
+namespace cunumeric {
+
+struct LoadTextArgs {
+  const Array& out;
+  std::string path;
+  // The lines start at byte `begin` of the file, and the bytes up to `end` are split evenly among
+  // `num_splits` point tasks. Each task parses the lines that start in its split.
+  size_t begin;
+  size_t end;
+  size_t split;
+  size_t num_splits;
+  // The field separator, or 0 for runs of whitespace
+  char delimiter;
+  // Text from this prefix to the end of the line is skipped, unless the prefix is empty
+  std::string comments;
+  size_t num_columns;
+  // The columns to parse, in the order of the output
+  std::vector<int32_t> columns;
+  // Whether fields that can't be parsed are errors or take the fill value
+  bool strict;
+  double fill;
+};
+
+class LoadTextTask : public CuNumericTask<LoadTextTask> {
+ public:
+  static const int TASK_ID = CUNUMERIC_LOAD_TEXT;
+
+ public:
+  static void cpu_variant(legate::TaskContext& context);
+#ifdef LEGATE_USE_OPENMP
+  static void omp_variant(legate::TaskContext& context);
+#endif
+};
+
+}  // namespace cunumeric
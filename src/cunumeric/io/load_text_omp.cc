@@ -0,0 +1,80 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/load_text.h"
+#include "cunumeric/io/load_text_template.inl"
+
+#include <exception>
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL>
+struct LoadTextImplBody<VariantKind::OMP, VAL> {
+  std::pair<Buffer<VAL>, size_t> operator()(const LoadTextArgs& args,
+                                            const std::vector<char>& text,
+                                            size_t offset) const
+  {
+    const auto max_threads = omp_get_max_threads();
+    const char* data       = text.data();
+    const size_t size      = text.size();
+
+    // Each thread parses the lines that start in its share of the text, into its own values
+    std::vector<std::vector<VAL>> values(max_threads);
+    std::exception_ptr error;
+#pragma omp parallel
+    {
+      const int tid   = omp_get_thread_num();
+      const int count = omp_get_num_threads();
+      auto line_start = [&](int idx) {
+        size_t pos = size * idx / count;
+        if (pos == 0 || pos == size || data[pos - 1] == '\n') return pos;
+        auto eol = static_cast<const char*>(memchr(data + pos, '\n', size - pos));
+        return eol == nullptr ? size : static_cast<size_t>(eol - data) + 1;
+      };
+      const size_t lo = line_start(tid);
+      const size_t hi = line_start(tid + 1);
+      try {
+        parse_lines(args, data + lo, data + hi, offset + lo, values[tid]);
+      } catch (...) {
+#pragma omp critical
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+
+    std::vector<size_t> offsets(max_threads + 1, 0);
+    for (auto idx = 0; idx < max_threads; ++idx)
+      offsets[idx + 1] = offsets[idx] + values[idx].size();
+
+    auto result = create_buffer<VAL>(offsets.back(), Memory::Kind::SYSTEM_MEM);
+#pragma omp parallel for schedule(static, 1)
+    for (auto idx = 0; idx < max_threads; ++idx)
+      std::copy(values[idx].begin(), values[idx].end(), result.ptr(offsets[idx]));
+    return {result, offsets.back()};
+  }
+};
+
+/*static*/ void LoadTextTask::omp_variant(TaskContext& context)
+{
+  load_text_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,253 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/io/load_text.h"
+#include "cunumeric/io/file.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <LegateTypeCode CODE>
+struct support_load_text : std::false_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::INT8_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::INT16_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::INT32_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::INT64_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::UINT8_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::UINT16_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::UINT32_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::UINT64_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::HALF_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::FLOAT_LT> : std::true_type {
+};
+template <>
+struct support_load_text<LegateTypeCode::DOUBLE_LT> : std::true_type {
+};
+
+template <VariantKind KIND, typename VAL>
+struct LoadTextImplBody;
+
+static inline bool is_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+template <typename VAL>
+static VAL convert_value(double value)
+{
+  // Half-precision values are only constructed from single-precision ones
+  if constexpr (std::is_same<VAL, __half>::value)
+    return static_cast<__half>(static_cast<float>(value));
+  else
+    return static_cast<VAL>(value);
+}
+
+// Parses the whole of [first, last) as a number, and returns false if it isn't one
+template <typename VAL, std::enable_if_t<std::is_integral<VAL>::value>* = nullptr>
+static bool parse_value(const char* first, const char* last, VAL& value)
+{
+  if (first < last && *first == '+') ++first;
+  auto result = std::from_chars(first, last, value);
+  return result.ec == std::errc() && result.ptr == last;
+}
+
+template <typename VAL, std::enable_if_t<!std::is_integral<VAL>::value>* = nullptr>
+static bool parse_value(const char* first, const char* last, VAL& value)
+{
+  if (first < last && *first == '+') ++first;
+  double parsed;
+#ifdef __cpp_lib_to_chars
+  // The floating-point overloads are exact and don't depend on the locale
+  auto result = std::from_chars(first, last, parsed);
+  if (result.ec != std::errc() || result.ptr != last) return false;
+#else
+  // strtod needs a terminated string
+  std::string field(first, last);
+  char* end;
+  parsed = strtod(field.c_str(), &end);
+  if (field.empty() || end != field.c_str() + field.size()) return false;
+#endif
+  value = convert_value<VAL>(parsed);
+  return true;
+}
+
+// Parses the lines in [first, last), which start at byte `offset` of the file, and appends the
+// values of the selected columns of each to `values`
+template <typename VAL>
+static void parse_lines(const LoadTextArgs& args,
+                        const char* first,
+                        const char* last,
+                        size_t offset,
+                        std::vector<VAL>& values)
+{
+  const char* start = first;
+  std::vector<std::pair<const char*, const char*>> fields;
+  while (first < last) {
+    auto eol = static_cast<const char*>(memchr(first, '\n', last - first));
+    if (eol == nullptr) eol = last;
+    auto line = first;
+    auto end  = eol;
+    first     = eol + 1;
+
+    if (!args.comments.empty())
+      end = std::search(line, end, args.comments.begin(), args.comments.end());
+    while (line < end && is_space(*line)) ++line;
+    while (end > line && is_space(end[-1])) --end;
+    // Blank lines and lines with only comments have no values
+    if (line == end) continue;
+
+    fields.clear();
+    if (args.delimiter == 0)
+      while (line < end) {
+        auto field = line;
+        while (line < end && !is_space(*line)) ++line;
+        fields.emplace_back(field, line);
+        while (line < end && is_space(*line)) ++line;
+      }
+    else
+      while (true) {
+        auto next = std::find(line, end, args.delimiter);
+        auto lo   = line;
+        auto hi   = next;
+        while (lo < hi && is_space(*lo)) ++lo;
+        while (hi > lo && is_space(hi[-1])) --hi;
+        fields.emplace_back(lo, hi);
+        if (next == end) break;
+        line = next + 1;
+      }
+
+    auto position = [&]() { return std::to_string(offset + (eol - start)) + " of " + args.path; };
+    if (fields.size() != args.num_columns)
+      throw legate::TaskException("Expected " + std::to_string(args.num_columns) +
+                                  " columns in the line ending at byte " + position());
+    for (auto column : args.columns) {
+      auto& field = fields[column];
+      VAL value;
+      if (!parse_value(field.first, field.second, value)) {
+        if (args.strict)
+          throw legate::TaskException("Could not convert '" +
+                                      std::string(field.first, field.second) +
+                                      "' to a number in the line ending at byte " + position());
+        value = convert_value<VAL>(args.fill);
+      }
+      values.push_back(value);
+    }
+  }
+}
+
+// Returns the start of the first line that starts at or after byte `pos` of the file
+static inline size_t find_line_start(const File& file, size_t pos, size_t begin, size_t end)
+{
+  if (pos <= begin || pos >= end) return std::min(std::max(pos, begin), end);
+  constexpr size_t BLOCK_SIZE = 64 << 10;
+  std::vector<char> buffer(BLOCK_SIZE);
+  auto block = buffer.data();
+  // The line starts at `pos` if the byte before it ends a line
+  for (size_t offset = pos - 1; offset < end; offset += BLOCK_SIZE) {
+    const size_t size = std::min(BLOCK_SIZE, end - offset);
+    file.read(block, size, offset);
+    auto eol = static_cast<const char*>(memchr(block, '\n', size));
+    if (eol != nullptr) return offset + (eol - block) + 1;
+  }
+  return end;
+}
+
+template <VariantKind KIND>
+struct LoadTextImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_load_text<CODE>::value>* = nullptr>
+  void operator()(LoadTextArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    File file(args.path, File::Mode::READ);
+    auto split_point = [&](size_t split) {
+      return args.begin + (args.end - args.begin) * split / args.num_splits;
+    };
+    const size_t lo = find_line_start(file, split_point(args.split), args.begin, args.end);
+    const size_t hi = find_line_start(file, split_point(args.split + 1), args.begin, args.end);
+
+    std::vector<char> text(hi - lo);
+    file.read(text.data(), text.size(), lo);
+
+    auto result = LoadTextImplBody<KIND, VAL>{}(args, text, lo);
+    args.out.return_data(result.first, Point<1>(result.second));
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_load_text<CODE>::value>* = nullptr>
+  void operator()(LoadTextArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void load_text_template(TaskContext& context)
+{
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+
+  // The launch is one-dimensional, and a task that isn't part of one parses the only split
+  auto index = context.get_task_index();
+  // Strings are passed as tuples of bytes, like paths
+  auto comments = path_from_scalar(scalars[5]);
+  auto columns  = scalars[7].values<int32_t>();
+  LoadTextArgs args{outputs[0],
+                    path_from_scalar(scalars[0]),
+                    scalars[1].value<uint64_t>(),
+                    scalars[2].value<uint64_t>(),
+                    index.get_dim() > 0 ? static_cast<size_t>(index[0]) : 0,
+                    scalars[3].value<uint64_t>(),
+                    static_cast<char>(scalars[4].value<int8_t>()),
+                    comments,
+                    scalars[6].value<uint64_t>(),
+                    std::vector<int32_t>(columns.ptr(), columns.ptr() + columns.size()),
+                    scalars[8].value<bool>(),
+                    scalars[9].value<double>()};
+  type_dispatch(args.out.code(), LoadTextImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
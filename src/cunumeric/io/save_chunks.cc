@@ -0,0 +1,54 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/save_chunks.h"
+#include "cunumeric/io/save_chunks_template.inl"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL, int32_t DIM>
+struct SaveChunksImplBody<VariantKind::CPU, VAL, DIM> {
+  void operator()(const SaveChunksArgs& args,
+                  AccessorRO<VAL, DIM> in,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& chunk_shape,
+                  const Rect<DIM>& chunks) const
+  {
+    ChunkCodec codec(sizeof(VAL), args.level, args.shuffle);
+    std::vector<char> data, buffer;
+    for (PointInRectIterator<DIM> chunk(chunks); chunk.valid(); ++chunk)
+      save_chunk(args, codec, in, rect, chunk_shape, *chunk, buffer, data);
+  }
+};
+
+/*static*/ void SaveChunksTask::cpu_variant(TaskContext& context)
+{
+  save_chunks_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  SaveChunksTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
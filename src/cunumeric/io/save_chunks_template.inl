@@ -0,0 +1,96 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/io/save_chunks.h"
+#include "cunumeric/io/chunks.h"
+#include "cunumeric/io/file.h"
+
+#include <cstring>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, typename VAL, int DIM>
+struct SaveChunksImplBody;
+
+// Encodes the part of the chunk that lies within the tile and writes it to the chunk's file, using
+// `buffer` and `data` to hold the decoded and encoded chunk
+template <typename VAL, int DIM>
+static void save_chunk(const SaveChunksArgs& args,
+                       const ChunkCodec& codec,
+                       const AccessorRO<VAL, DIM>& in,
+                       const Rect<DIM>& rect,
+                       const Point<DIM>& chunk_shape,
+                       const Point<DIM>& chunk,
+                       std::vector<char>& buffer,
+                       std::vector<char>& data)
+{
+  size_t chunk_volume = 1;
+  for (int32_t dim = 0; dim < DIM; ++dim) chunk_volume *= chunk_shape[dim];
+  // Chunks at the edges of the array are padded with zeros
+  buffer.assign(chunk_volume * sizeof(VAL), 0);
+
+  auto values = reinterpret_cast<VAL*>(buffer.data());
+  for_each_chunk_row(chunk, chunk_shape, rect, [&](auto point, size_t offset, size_t count) {
+    memcpy(values + offset, in.ptr(point), count * sizeof(VAL));
+  });
+  codec.encode(buffer.data(), buffer.size(), data);
+
+  File file(chunk_path(args.path, chunk), File::Mode::CREATE);
+  file.write(data.data(), data.size(), 0);
+}
+
+template <VariantKind KIND>
+struct SaveChunksImpl {
+  template <LegateTypeCode CODE, int DIM>
+  void operator()(SaveChunksArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.in.shape<DIM>();
+    if (rect.empty()) return;
+
+    // The mapper gives the task an exact row-major instance, so every row of a chunk is
+    // contiguous in memory
+    auto in = args.in.read_accessor<VAL, DIM>(rect);
+    Point<DIM> chunk_shape(args.chunk_shape);
+
+    SaveChunksImplBody<KIND, VAL, DIM>{}(
+      args, in, rect, chunk_shape, chunks_of(rect, chunk_shape));
+  }
+};
+
+template <VariantKind KIND>
+static void save_chunks_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+
+  SaveChunksArgs args{inputs[0],
+                      path_from_scalar(scalars[0]),
+                      scalars[1].value<DomainPoint>(),
+                      scalars[2].value<int32_t>(),
+                      scalars[3].value<bool>()};
+  double_dispatch(args.in.dim(), args.in.code(), SaveChunksImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,73 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include "cunumeric/io/save_npy.h"
+#include "cunumeric/io/save_npy_template.inl"
+
+#include <algorithm>
+#include <exception>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL, int32_t DIM>
+struct SaveNpyImplBody<VariantKind::OMP, VAL, DIM> {
+  // Runs are split into chunks of this many bytes, so that all threads have writes in flight even
+  // when the whole tile is a single run
+  static constexpr size_t CHUNK_SIZE = 4 << 20;
+
+  void operator()(const File& file,
+                  AccessorRO<VAL, DIM> in,
+                  const Pitches<DIM - 1>& pitches,
+                  const Rect<DIM>& rect,
+                  const Point<DIM>& strides,
+                  size_t volume,
+                  size_t offset) const
+  {
+    const size_t run            = contiguous_extent(rect, strides);
+    const size_t chunk          = std::max<size_t>(CHUNK_SIZE / sizeof(VAL), 1);
+    const size_t chunks_per_run = (run + chunk - 1) / chunk;
+    const size_t num_chunks     = volume / run * chunks_per_run;
+
+    // Exceptions can't leave a parallel region, so the first one is rethrown after it
+    std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t idx = 0; idx < num_chunks; ++idx) {
+      const size_t start = idx % chunks_per_run * chunk;
+      const size_t count = std::min(chunk, run - start);
+      auto point         = pitches.unflatten(idx / chunks_per_run * run + start, rect.lo);
+      size_t file_idx    = 0;
+      for (int32_t dim = 0; dim < DIM; ++dim) file_idx += point[dim] * strides[dim];
+      try {
+        file.write(in.ptr(point), count * sizeof(VAL), offset + file_idx * sizeof(VAL));
+      } catch (...) {
+#pragma omp critical
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+  }
+};
+
+/*static*/ void SaveNpyTask::omp_variant(TaskContext& context)
+{
+  save_npy_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
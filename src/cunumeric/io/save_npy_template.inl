@@ -0,0 +1,70 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/io/save_npy.h"
+#include "cunumeric/io/file.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, typename VAL, int DIM>
+struct SaveNpyImplBody;
+
+template <VariantKind KIND>
+struct SaveNpyImpl {
+  template <LegateTypeCode CODE, int DIM>
+  void operator()(SaveNpyArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rect = args.in.shape<DIM>();
+
+    Pitches<DIM - 1> pitches;
+    size_t volume = pitches.flatten(rect);
+
+    if (volume == 0) return;
+
+    // The mapper gives the task an exact row-major instance, so every run of elements that is
+    // contiguous in the file is also contiguous in memory
+    auto in = args.in.read_accessor<VAL, DIM>(rect);
+    Point<DIM> strides(args.strides);
+
+    File file(args.path, File::Mode::WRITE);
+    SaveNpyImplBody<KIND, VAL, DIM>{}(file, in, pitches, rect, strides, volume, args.offset);
+  }
+};
+
+template <VariantKind KIND>
+static void save_npy_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+
+  SaveNpyArgs args{inputs[0],
+                   path_from_scalar(scalars[0]),
+                   scalars[1].value<uint64_t>(),
+                   scalars[2].value<DomainPoint>()};
+  double_dispatch(args.in.dim(), args.in.code(), SaveNpyImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -14,6 +14,9 @@
  *
  */
 
+#include <atomic>
+#include <cstdlib>
+
 #include "cunumeric/mapper.h"
 
 using namespace legate;
@@ -21,20 +24,242 @@ using namespace legate::mapping;
 
 namespace cunumeric {
 
+static Legion::Logger log_mapper("cunumeric.mapper");
+
 CuNumericMapper::CuNumericMapper(Legion::Runtime* rt, Legion::Machine m, const LibraryContext& ctx)
   : BaseMapper(rt, m, ctx),
     min_gpu_chunk(extract_env("CUNUMERIC_MIN_GPU_CHUNK", 1 << 20, 2)),
     min_cpu_chunk(extract_env("CUNUMERIC_MIN_CPU_CHUNK", 1 << 14, 2)),
     min_omp_chunk(extract_env("CUNUMERIC_MIN_OMP_CHUNK", 1 << 17, 2)),
-    eager_fraction(extract_env("CUNUMERIC_EAGER_FRACTION", 16, 1))
+    eager_fraction(extract_env("CUNUMERIC_EAGER_FRACTION", 16, 1)),
+    use_cost_model(extract_env("CUNUMERIC_USE_COST_MODEL", 0, 0))
+{
+  // Estimates from an earlier run are loaded from this file. Only the first node writes them back,
+  // so that the nodes don't race on the file.
+  const char* filename = getenv("CUNUMERIC_COST_MODEL");
+  if (use_cost_model && filename != nullptr) {
+    cost_model.load(filename);
+    auto local_node =
+      Legion::Machine::ProcessorQuery(m).local_address_space().first().address_space();
+    if (local_node == 0) cost_model_file = filename;
+  }
+}
+
+CuNumericMapper::~CuNumericMapper(void)
+{
+  // Likewise, only one mapper of the process writes the file
+  static std::atomic<bool> saved{false};
+  if (!cost_model_file.empty() && !saved.exchange(true)) cost_model.save(cost_model_file);
+}
+
+namespace  // unnamed
 {
+// Returns the volume of the largest store the task accesses, along with its type
+std::pair<size_t, LegateTypeCode> largest_store(const Task& task)
+{
+  size_t volume       = 0;
+  LegateTypeCode code = LegateTypeCode::BOOL_LT;
+  auto visit          = [&](const std::vector<Store>& stores) {
+    for (auto& store : stores) {
+      if (store.is_future() || store.unbound()) continue;
+      size_t store_volume = store.domain().get_volume();
+      if (store_volume > volume) {
+        volume = store_volume;
+        code   = store.code();
+      }
+    }
+  };
+  visit(task.inputs());
+  visit(task.outputs());
+  visit(task.reductions());
+  return std::make_pair(volume, code);
 }
 
+struct element_size_fn {
+  template <LegateTypeCode CODE>
+  size_t operator()() const
+  {
+    return sizeof(legate_type_of<CODE>);
+  }
+};
+
+// Host to GPU transfer bandwidth in bytes per microsecond, roughly that of PCIe
+constexpr double HOST_DEVICE_BYTES_PER_USEC = 1e4;
+
+// A processor kind that was never measured for a configuration gets tried when its prediction is
+// within this factor of the best one
+constexpr double EXPLORATION_FACTOR = 4.0;
+
+TaskTarget to_target(Legion::Processor::Kind kind)
+{
+  switch (kind) {
+    case Legion::Processor::TOC_PROC: return TaskTarget::GPU;
+    case Legion::Processor::OMP_PROC: return TaskTarget::OMP;
+    default: break;
+  }
+  return TaskTarget::CPU;
+}
+
+Legion::Processor::Kind to_kind(TaskTarget target)
+{
+  switch (target) {
+    case TaskTarget::GPU: return Legion::Processor::TOC_PROC;
+    case TaskTarget::OMP: return Legion::Processor::OMP_PROC;
+    default: break;
+  }
+  return Legion::Processor::LOC_PROC;
+}
+
+}  // namespace
+
 TaskTarget CuNumericMapper::task_target(const Task& task, const std::vector<TaskTarget>& options)
 {
   return *options.begin();
 }
 
+std::vector<TaskTarget> CuNumericMapper::variant_targets(const Legion::Mapping::MapperContext ctx,
+                                                         const Legion::Task& task,
+                                                         TaskTarget preferred)
+{
+  std::vector<TaskTarget> targets{preferred};
+  auto add_target = [&](TaskTarget target, const std::vector<Legion::Processor>& procs) {
+    if (target == preferred || procs.empty()) return;
+    std::vector<Legion::VariantID> variants;
+    runtime->find_valid_variants(ctx, task.task_id, variants, to_kind(target));
+    if (!variants.empty()) targets.push_back(target);
+  };
+  add_target(TaskTarget::GPU, local_gpus);
+  add_target(TaskTarget::OMP, local_omps);
+  add_target(TaskTarget::CPU, local_cpus);
+  return targets;
+}
+
+TaskTarget CuNumericMapper::predict_target(const Legion::Task& task,
+                                           const Task& legate_task,
+                                           const std::vector<TaskTarget>& options)
+{
+  auto [volume, code] = largest_store(legate_task);
+  if (volume == 0) return *options.begin();
+
+  // The stores of an index task span the whole launch, while map_task and report_profiling
+  // measure single points, so the prediction is made for the volume of a point
+  if (task.is_index_space) {
+    size_t num_points = task.index_domain.get_volume();
+    volume            = (volume + num_points - 1) / num_points;
+  }
+
+  // Running on the other side of the host and the GPUs than where the inputs were written moves
+  // them across
+  auto [on_host, on_gpu] = input_residency(task);
+  const double bytes     = static_cast<double>(volume) * type_dispatch(code, element_size_fn{});
+  auto predict           = [&](TaskTarget target) {
+    double moved = target == TaskTarget::GPU ? on_host : on_gpu;
+    return cost_model.predict(legate_task.task_id(), target, code, volume) +
+           moved * bytes / HOST_DEVICE_BYTES_PER_USEC;
+  };
+
+  // Options come in order of preference, so the first one wins ties
+  TaskTarget best_target = *options.begin();
+  double best_time       = predict(best_target);
+  for (auto target : options) {
+    double time = predict(target);
+    if (time < best_time) {
+      best_target = target;
+      best_time   = time;
+    }
+  }
+
+  // Only the processor kinds that tasks run on get measured, so the estimates of a kind that is
+  // never picked would never be corrected. Kinds that are close enough get tried once.
+  for (auto target : options)
+    if (target != best_target &&
+        !cost_model.measured(legate_task.task_id(), target, code, volume) &&
+        predict(target) <= EXPLORATION_FACTOR * best_time)
+      return target;
+  return best_target;
+}
+
+std::pair<double, double> CuNumericMapper::input_residency(const Legion::Task& task)
+{
+  // Fields that no task has written yet are assumed to be on the host
+  uint32_t num_read = 0;
+  uint32_t num_gpu  = 0;
+  std::lock_guard<std::mutex> guard(residency_lock);
+  for (auto& req : task.regions) {
+    if (!(req.privilege & LEGION_READ_PRIV)) continue;
+    for (auto fid : req.privilege_fields) {
+      ++num_read;
+      auto finder = written_on_gpu.find(std::make_pair(req.region.get_tree_id(), fid));
+      if (finder != written_on_gpu.end() && finder->second) ++num_gpu;
+    }
+  }
+  if (num_read == 0) return std::make_pair(0.0, 0.0);
+  return std::make_pair(double(num_read - num_gpu) / num_read, double(num_gpu) / num_read);
+}
+
+void CuNumericMapper::select_task_options(const Legion::Mapping::MapperContext ctx,
+                                          const Legion::Task& task,
+                                          TaskOptions& output)
+{
+  BaseMapper::select_task_options(ctx, task, output);
+  if (!use_cost_model) return;
+
+  // The processor kind the base mapper picked stays the preferred one
+  auto preferred = to_target(output.initial_proc.kind());
+  auto options   = variant_targets(ctx, task, preferred);
+  if (options.size() == 1) return;
+
+  Task legate_task(&task, context, runtime, ctx);
+  auto target = predict_target(task, legate_task, options);
+  if (target == preferred) return;
+  switch (target) {
+    case TaskTarget::GPU: output.initial_proc = local_gpus.front(); break;
+    case TaskTarget::OMP: output.initial_proc = local_omps.front(); break;
+    default: output.initial_proc = local_cpus.front(); break;
+  }
+}
+
+void CuNumericMapper::map_task(const Legion::Mapping::MapperContext ctx,
+                               const Legion::Task& task,
+                               const MapTaskInput& input,
+                               MapTaskOutput& output)
+{
+  BaseMapper::map_task(ctx, task, input, output);
+  if (!use_cost_model) return;
+
+  Task legate_task(&task, context, runtime, ctx);
+  auto [volume, code] = largest_store(legate_task);
+  if (volume == 0) return;
+  auto target = to_target(task.target_proc.kind());
+
+  {
+    std::lock_guard<std::mutex> guard(residency_lock);
+    for (auto& req : task.regions) {
+      if (!(req.privilege & (LEGION_WRITE_PRIV | LEGION_REDUCE_PRIV))) continue;
+      for (auto fid : req.privilege_fields)
+        written_on_gpu[std::make_pair(req.region.get_tree_id(), fid)] = target == TaskTarget::GPU;
+    }
+  }
+
+  if (cost_model.needs_samples(legate_task.task_id(), target, code, volume))
+    output.task_prof_requests.add_measurement<Legion::ProfilingMeasurements::OperationTimeline>();
+}
+
+void CuNumericMapper::report_profiling(const Legion::Mapping::MapperContext ctx,
+                                       const Legion::Task& task,
+                                       const TaskProfilingInfo& input)
+{
+  Legion::ProfilingMeasurements::OperationTimeline timeline;
+  if (!input.profiling_responses.get_measurement(timeline)) return;
+  // Timestamps are in nanoseconds
+  double usecs = (timeline.end_time - timeline.start_time) / 1e3;
+
+  Task legate_task(&task, context, runtime, ctx);
+  auto [volume, code] = largest_store(legate_task);
+  auto target         = to_target(task.target_proc.kind());
+  cost_model.record(legate_task.task_id(), target, code, volume, usecs);
+}
+
 Scalar CuNumericMapper::tunable_value(TunableID tunable_id)
 {
   switch (tunable_id) {
@@ -54,7 +279,7 @@ Scalar CuNumericMapper::tunable_value(TunableID tunable_id)
     }
     case CUNUMERIC_TUNABLE_MAX_EAGER_VOLUME: {
       int32_t eager_volume = 0;
-      // TODO: make these profile guided
+      // The base volume; the runtime scales it for operations that cost more per element
       if (eager_fraction > 0) {
         if (!local_gpus.empty())
           eager_volume = min_gpu_chunk / eager_fraction;
@@ -74,11 +299,24 @@ Scalar CuNumericMapper::tunable_value(TunableID tunable_id)
       int32_t has_numamem = query.count() > 0;
       return Scalar(has_numamem);
     }
+    case CUNUMERIC_TUNABLE_NUM_NODES: {
+      int32_t num_nodes = total_nodes;
+      return Scalar(num_nodes);
+    }
     default: break;
   }
   LEGATE_ABORT;  // unknown tunable value
 }
 
+// Returns true if the store has fewer real dimensions than its region, i.e., if some dimension was
+// projected out
+static bool is_projection(const Store& store)
+{
+  if (store.is_future()) return false;
+  auto num_imaginary_dims = store.find_imaginary_dims().size();
+  return store.region_field().dim() + num_imaginary_dims > store.dim();
+}
+
 std::vector<StoreMapping> CuNumericMapper::store_mappings(
   const mapping::Task& task, const std::vector<mapping::StoreTarget>& options)
 {
@@ -114,19 +352,37 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       } else
         return {};
     }
+    case CUNUMERIC_BATCHED_MATMUL:
     case CUNUMERIC_MATMUL:
     case CUNUMERIC_MATVECMUL: {
-      // TODO: Our actual requirements are a little less strict than this; we require each array or
-      // vector to have a stride of 1 on at least one dimension.
+      // The BLAS calls only need each input matrix or vector to have a stride of 1 on one
+      // dimension, and the tasks detect transposed layouts with stride_for_blas. Any existing
+      // instance of an input with at most two real dimensions meets this, including one that
+      // covers more than the task's tile, unless the store is a projection that dropped the unit
+      // stride dimension of its region. The dimensions that MATMUL and MATVECMUL promote their
+      // inputs with have a stride of 0 on any instance, and transposed views only permute the
+      // strides, so those inputs reuse whatever instance is already there. Outputs are written
+      // assuming a C-order inner stride of 1, and the batched task assumes it for all of its
+      // stores, so these keep exact C-order instances.
+      const bool batched = task.task_id() == CUNUMERIC_BATCHED_MATMUL;
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
       auto& outputs = task.outputs();
-      for (auto& input : inputs) {
+      for (uint32_t idx = 0; idx < inputs.size(); ++idx) {
+        auto& input = inputs[idx];
+        if (!batched && !input.is_future() && !is_projection(input) &&
+            input.dim() - input.find_imaginary_dims().size() <= 2) {
+          log_mapper.debug() << "Input " << idx << " of task " << task.task_id()
+                             << " reuses any existing instance";
+          continue;
+        }
         mappings.push_back(StoreMapping::default_mapping(input, options.front()));
+        mappings.back().policy.ordering.c_order();
         mappings.back().policy.exact = true;
       }
       for (auto& output : outputs) {
         mappings.push_back(StoreMapping::default_mapping(output, options.front()));
+        mappings.back().policy.ordering.c_order();
         mappings.back().policy.exact = true;
       }
       return std::move(mappings);
@@ -134,7 +390,12 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
     case CUNUMERIC_POTRF:
     case CUNUMERIC_TRSM:
     case CUNUMERIC_SYRK:
-    case CUNUMERIC_GEMM: {
+    case CUNUMERIC_GEMM:
+    case CUNUMERIC_GEQRF:
+    case CUNUMERIC_GETRF:
+    case CUNUMERIC_GETRS:
+    case CUNUMERIC_GESVD:
+    case CUNUMERIC_SYEVD: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
       auto& outputs = task.outputs();
@@ -161,6 +422,10 @@ std::vector<StoreMapping> CuNumericMapper::store_mappings(
       mappings.back().policy.exact = true;
       return std::move(mappings);
     }
+    case CUNUMERIC_LOAD_CHUNKS:
+    case CUNUMERIC_LOAD_NPY:
+    case CUNUMERIC_SAVE_CHUNKS:
+    case CUNUMERIC_SAVE_NPY:
     case CUNUMERIC_SORT: {
       std::vector<StoreMapping> mappings;
       auto& inputs  = task.inputs();
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
+
 #include "cunumeric/cunumeric.h"
+#include "cunumeric/cost_model.h"
 
 #include "core/mapping/base_mapper.h"
 
@@ -27,7 +31,7 @@ class CuNumericMapper : public legate::mapping::BaseMapper {
   CuNumericMapper(Legion::Runtime* rt,
                   Legion::Machine machine,
                   const legate::LibraryContext& context);
-  virtual ~CuNumericMapper(void) {}
+  virtual ~CuNumericMapper(void);
 
  private:
   CuNumericMapper(const CuNumericMapper& rhs)            = delete;
@@ -44,11 +48,47 @@ class CuNumericMapper : public legate::mapping::BaseMapper {
     const std::vector<legate::mapping::StoreTarget>& options) override;
   virtual legate::Scalar tunable_value(legate::TunableID tunable_id) override;
 
+  // Legion mapping functions, used by the cost model to pick processor kinds, measure task
+  // durations and track where data was written
+ public:
+  virtual void select_task_options(const Legion::Mapping::MapperContext ctx,
+                                   const Legion::Task& task,
+                                   TaskOptions& output) override;
+  virtual void map_task(const Legion::Mapping::MapperContext ctx,
+                        const Legion::Task& task,
+                        const MapTaskInput& input,
+                        MapTaskOutput& output) override;
+  virtual void report_profiling(const Legion::Mapping::MapperContext ctx,
+                                const Legion::Task& task,
+                                const TaskProfilingInfo& input) override;
+
  private:
   const int32_t min_gpu_chunk;
   const int32_t min_cpu_chunk;
   const int32_t min_omp_chunk;
   const int32_t eager_fraction;
+  const bool use_cost_model;
+  std::string cost_model_file;
+  CostModel cost_model;
+
+ private:
+  // Returns the processor kinds with a variant of the task, starting with the preferred one
+  std::vector<legate::mapping::TaskTarget> variant_targets(
+    const Legion::Mapping::MapperContext ctx,
+    const Legion::Task& task,
+    legate::mapping::TaskTarget preferred);
+  // Returns the option with the shortest predicted time, or one that is worth measuring
+  legate::mapping::TaskTarget predict_target(
+    const Legion::Task& task,
+    const legate::mapping::Task& legate_task,
+    const std::vector<legate::mapping::TaskTarget>& options);
+  // Returns the fractions of the fields the task reads that were last written on the host and on
+  // a GPU
+  std::pair<double, double> input_residency(const Legion::Task& task);
+
+  // Whether the last task that wrote each field of a region tree ran on a GPU
+  std::mutex residency_lock;
+  std::map<std::pair<Legion::RegionTreeID, Legion::FieldID>, bool> written_on_gpu;
 };
 
 }  // namespace cunumeric
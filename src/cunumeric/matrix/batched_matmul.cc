@@ -0,0 +1,257 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/batched_matmul.h"
+#include "cunumeric/matrix/batched_matmul_template.inl"
+#include "cunumeric/matrix/util.h"
+
+#include <cblas.h>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+namespace  // unnamed
+{
+static void gemm(size_t m,
+                 size_t n,
+                 size_t k,
+                 float* lhs,
+                 const float* rhs1,
+                 const float* rhs2,
+                 size_t lhs_stride,
+                 size_t rhs1_stride,
+                 size_t rhs2_stride,
+                 bool rhs1_transposed,
+                 bool rhs2_transposed)
+{
+  cblas_sgemm(CblasRowMajor,
+              rhs1_transposed ? CblasTrans : CblasNoTrans,
+              rhs2_transposed ? CblasTrans : CblasNoTrans,
+              m,
+              n,
+              k,
+              1,
+              rhs1,
+              rhs1_stride,
+              rhs2,
+              rhs2_stride,
+              0,
+              lhs,
+              lhs_stride);
+}
+
+static void gemm(size_t m,
+                 size_t n,
+                 size_t k,
+                 double* lhs,
+                 const double* rhs1,
+                 const double* rhs2,
+                 size_t lhs_stride,
+                 size_t rhs1_stride,
+                 size_t rhs2_stride,
+                 bool rhs1_transposed,
+                 bool rhs2_transposed)
+{
+  cblas_dgemm(CblasRowMajor,
+              rhs1_transposed ? CblasTrans : CblasNoTrans,
+              rhs2_transposed ? CblasTrans : CblasNoTrans,
+              m,
+              n,
+              k,
+              1,
+              rhs1,
+              rhs1_stride,
+              rhs2,
+              rhs2_stride,
+              0,
+              lhs,
+              lhs_stride);
+}
+
+static void gemm(size_t m,
+                 size_t n,
+                 size_t k,
+                 complex<float>* lhs_,
+                 const complex<float>* rhs1_,
+                 const complex<float>* rhs2_,
+                 size_t lhs_stride,
+                 size_t rhs1_stride,
+                 size_t rhs2_stride,
+                 bool rhs1_transposed,
+                 bool rhs2_transposed)
+{
+  __complex__ float* lhs        = reinterpret_cast<__complex__ float*>(lhs_);
+  const __complex__ float* rhs1 = reinterpret_cast<const __complex__ float*>(rhs1_);
+  const __complex__ float* rhs2 = reinterpret_cast<const __complex__ float*>(rhs2_);
+  __complex__ float alpha       = 1.0;
+  __complex__ float beta        = 0.0;
+
+  cblas_cgemm(CblasRowMajor,
+              rhs1_transposed ? CblasTrans : CblasNoTrans,
+              rhs2_transposed ? CblasTrans : CblasNoTrans,
+              m,
+              n,
+              k,
+              &alpha,
+              rhs1,
+              rhs1_stride,
+              rhs2,
+              rhs2_stride,
+              &beta,
+              lhs,
+              lhs_stride);
+}
+
+static void gemm(size_t m,
+                 size_t n,
+                 size_t k,
+                 complex<double>* lhs_,
+                 const complex<double>* rhs1_,
+                 const complex<double>* rhs2_,
+                 size_t lhs_stride,
+                 size_t rhs1_stride,
+                 size_t rhs2_stride,
+                 bool rhs1_transposed,
+                 bool rhs2_transposed)
+{
+  __complex__ double* lhs        = reinterpret_cast<__complex__ double*>(lhs_);
+  const __complex__ double* rhs1 = reinterpret_cast<const __complex__ double*>(rhs1_);
+  const __complex__ double* rhs2 = reinterpret_cast<const __complex__ double*>(rhs2_);
+  __complex__ double alpha       = 1.0;
+  __complex__ double beta        = 0.0;
+
+  cblas_zgemm(CblasRowMajor,
+              rhs1_transposed ? CblasTrans : CblasNoTrans,
+              rhs2_transposed ? CblasTrans : CblasNoTrans,
+              m,
+              n,
+              k,
+              &alpha,
+              rhs1,
+              rhs1_stride,
+              rhs2,
+              rhs2_stride,
+              &beta,
+              lhs,
+              lhs_stride);
+}
+
+}  // namespace
+
+template <LegateTypeCode CODE>
+struct BatchedMatMulImplBody<VariantKind::CPU, CODE> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  VAL* lhs,
+                  const VAL* rhs1,
+                  const VAL* rhs2,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    for (size_t idx = 0; idx < batch; ++idx)
+      gemm(m,
+           n,
+           k,
+           lhs + idx * lhs_batch_stride,
+           rhs1 + idx * rhs1_batch_stride,
+           rhs2 + idx * rhs2_batch_stride,
+           lhs_stride,
+           rhs1_stride,
+           rhs2_stride,
+           rhs1_transposed,
+           rhs2_transposed);
+  }
+};
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::CPU, LegateTypeCode::HALF_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  float* lhs,
+                  const __half* rhs1,
+                  const __half* rhs2,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto rhs1_copy = allocate_buffer(m * k);
+    auto rhs2_copy = allocate_buffer(k * n);
+
+    for (size_t idx = 0; idx < batch; ++idx) {
+      auto rhs1_ = rhs1 + idx * rhs1_batch_stride;
+      auto rhs2_ = rhs2 + idx * rhs2_batch_stride;
+
+      if (rhs1_transposed)
+        half_matrix_to_float(rhs1_copy, rhs1_, k, m, rhs1_stride);
+      else
+        half_matrix_to_float(rhs1_copy, rhs1_, m, k, rhs1_stride);
+
+      if (rhs2_transposed)
+        half_matrix_to_float(rhs2_copy, rhs2_, n, k, rhs2_stride);
+      else
+        half_matrix_to_float(rhs2_copy, rhs2_, k, n, rhs2_stride);
+
+      gemm(m,
+           n,
+           k,
+           lhs + idx * lhs_batch_stride,
+           rhs1_copy,
+           rhs2_copy,
+           lhs_stride,
+           rhs1_transposed ? m : k,
+           rhs2_transposed ? k : n,
+           rhs1_transposed,
+           rhs2_transposed);
+    }
+  }
+};
+
+/*static*/ void BatchedMatMulTask::cpu_variant(TaskContext& context)
+{
+#ifdef LEGATE_USE_OPENMP
+  openblas_set_num_threads(1);  // make sure this isn't overzealous
+#endif
+  batched_matmul_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void)
+{
+  BatchedMatMulTask::register_variants();
+}
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,287 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/batched_matmul.h"
+#include "cunumeric/matrix/batched_matmul_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+
+// As in the non-batched matmul, the operands are swapped so that cuBLAS computes the column-major
+// transpose of the row-major product.
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  float* lhs,
+                  const float* rhs1,
+                  const float* rhs2,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    const float alpha = 1.0;
+    const float beta  = 0.0;
+
+    CHECK_CUBLAS(cublasSgemmStridedBatched(cublas_handle,
+                                           rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           n,
+                                           m,
+                                           k,
+                                           &alpha,
+                                           rhs2,
+                                           rhs2_stride,
+                                           rhs2_batch_stride,
+                                           rhs1,
+                                           rhs1_stride,
+                                           rhs1_batch_stride,
+                                           &beta,
+                                           lhs,
+                                           lhs_stride,
+                                           lhs_batch_stride,
+                                           batch));
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  double* lhs,
+                  const double* rhs1,
+                  const double* rhs2,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    const double alpha = 1.0;
+    const double beta  = 0.0;
+
+    CHECK_CUBLAS(cublasDgemmStridedBatched(cublas_handle,
+                                           rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           n,
+                                           m,
+                                           k,
+                                           &alpha,
+                                           rhs2,
+                                           rhs2_stride,
+                                           rhs2_batch_stride,
+                                           rhs1,
+                                           rhs1_stride,
+                                           rhs1_batch_stride,
+                                           &beta,
+                                           lhs,
+                                           lhs_stride,
+                                           lhs_batch_stride,
+                                           batch));
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::GPU, LegateTypeCode::HALF_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  float* lhs,
+                  const __half* rhs1,
+                  const __half* rhs2,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    const float alpha = 1.0;
+    const float beta  = 0.0;
+
+    CHECK_CUBLAS(cublasGemmStridedBatchedEx(cublas_handle,
+                                            rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                            rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                            n,
+                                            m,
+                                            k,
+                                            &alpha,
+                                            rhs2,
+                                            CUDA_R_16F,
+                                            rhs2_stride,
+                                            rhs2_batch_stride,
+                                            rhs1,
+                                            CUDA_R_16F,
+                                            rhs1_stride,
+                                            rhs1_batch_stride,
+                                            &beta,
+                                            lhs,
+                                            CUDA_R_32F,
+                                            lhs_stride,
+                                            lhs_batch_stride,
+                                            batch,
+                                            CUBLAS_COMPUTE_32F,
+                                            CUBLAS_GEMM_DEFAULT));
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  complex<float>* lhs_,
+                  const complex<float>* rhs1_,
+                  const complex<float>* rhs2_,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    cuComplex* lhs        = reinterpret_cast<cuComplex*>(lhs_);
+    const cuComplex* rhs1 = reinterpret_cast<const cuComplex*>(rhs1_);
+    const cuComplex* rhs2 = reinterpret_cast<const cuComplex*>(rhs2_);
+
+    const cuComplex alpha = make_float2(1.0, 0.0);
+    const cuComplex beta  = make_float2(0.0, 0.0);
+
+    CHECK_CUBLAS(cublasCgemmStridedBatched(cublas_handle,
+                                           rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           n,
+                                           m,
+                                           k,
+                                           &alpha,
+                                           rhs2,
+                                           rhs2_stride,
+                                           rhs2_batch_stride,
+                                           rhs1,
+                                           rhs1_stride,
+                                           rhs1_batch_stride,
+                                           &beta,
+                                           lhs,
+                                           lhs_stride,
+                                           lhs_batch_stride,
+                                           batch));
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+template <>
+struct BatchedMatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(size_t batch,
+                  size_t m,
+                  size_t n,
+                  size_t k,
+                  complex<double>* lhs_,
+                  const complex<double>* rhs1_,
+                  const complex<double>* rhs2_,
+                  size_t lhs_batch_stride,
+                  size_t lhs_stride,
+                  size_t rhs1_batch_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_batch_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed)
+  {
+    auto cublas_handle = get_cublas();
+    auto task_stream   = get_cached_stream();
+    CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
+
+    cuDoubleComplex* lhs        = reinterpret_cast<cuDoubleComplex*>(lhs_);
+    const cuDoubleComplex* rhs1 = reinterpret_cast<const cuDoubleComplex*>(rhs1_);
+    const cuDoubleComplex* rhs2 = reinterpret_cast<const cuDoubleComplex*>(rhs2_);
+
+    const cuDoubleComplex alpha = make_double2(1.0, 0.0);
+    const cuDoubleComplex beta  = make_double2(0.0, 0.0);
+
+    CHECK_CUBLAS(cublasZgemmStridedBatched(cublas_handle,
+                                           rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           rhs1_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
+                                           n,
+                                           m,
+                                           k,
+                                           &alpha,
+                                           rhs2,
+                                           rhs2_stride,
+                                           rhs2_batch_stride,
+                                           rhs1,
+                                           rhs1_stride,
+                                           rhs1_batch_stride,
+                                           &beta,
+                                           lhs,
+                                           lhs_stride,
+                                           lhs_batch_stride,
+                                           batch));
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
+/*static*/ void BatchedMatMulTask::gpu_variant(TaskContext& context)
+{
+  batched_matmul_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
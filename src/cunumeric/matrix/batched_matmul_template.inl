@@ -0,0 +1,134 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/batched_matmul.h"
+#include "cunumeric/matrix/util.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct BatchedMatMulImplBody;
+
+template <LegateTypeCode CODE>
+struct support_batched_matmul : std::false_type {
+};
+template <>
+struct support_batched_matmul<LegateTypeCode::DOUBLE_LT> : std::true_type {
+  using ACC_TYPE = double;
+};
+template <>
+struct support_batched_matmul<LegateTypeCode::FLOAT_LT> : std::true_type {
+  using ACC_TYPE = float;
+};
+template <>
+struct support_batched_matmul<LegateTypeCode::HALF_LT> : std::true_type {
+  using ACC_TYPE = float;
+};
+template <>
+struct support_batched_matmul<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+  using ACC_TYPE = complex<float>;
+};
+template <>
+struct support_batched_matmul<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+  using ACC_TYPE = complex<double>;
+};
+
+template <VariantKind KIND>
+struct BatchedMatMulImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_batched_matmul<CODE>::value>* = nullptr>
+  void operator()(BatchedMatMulArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+    using ACC = typename support_batched_matmul<CODE>::ACC_TYPE;
+
+    // The stores are only partitioned along the batch dimension, so each task gets whole matrices
+    auto lhs_shape  = args.lhs.shape<3>();
+    auto rhs1_shape = args.rhs1.shape<3>();
+    auto rhs2_shape = args.rhs2.shape<3>();
+
+    if (lhs_shape.empty() || rhs1_shape.empty()) return;
+
+    const auto batch = lhs_shape.hi[0] - lhs_shape.lo[0] + 1;
+    const auto m     = lhs_shape.hi[1] - lhs_shape.lo[1] + 1;
+    const auto n     = lhs_shape.hi[2] - lhs_shape.lo[2] + 1;
+    const auto k     = rhs1_shape.hi[2] - rhs1_shape.lo[2] + 1;
+
+#ifdef DEBUG_CUNUMERIC
+    assert(batch == rhs1_shape.hi[0] - rhs1_shape.lo[0] + 1);
+    assert(batch == rhs2_shape.hi[0] - rhs2_shape.lo[0] + 1);
+    assert(k == rhs2_shape.hi[1] - rhs2_shape.lo[1] + 1);
+#endif
+
+    size_t lhs_strides[3];
+    size_t rhs1_strides[3];
+    size_t rhs2_strides[3];
+
+    auto rhs1 = args.rhs1.read_accessor<VAL, 3>(rhs1_shape).ptr(rhs1_shape, rhs1_strides);
+    auto rhs2 = args.rhs2.read_accessor<VAL, 3>(rhs2_shape).ptr(rhs2_shape, rhs2_strides);
+    auto lhs  = args.lhs.write_accessor<ACC, 3>(lhs_shape).ptr(lhs_shape, lhs_strides);
+
+#ifdef DEBUG_CUNUMERIC
+    assert(lhs_strides[2] == 1);
+#endif
+
+    bool rhs1_transposed;
+    bool rhs2_transposed;
+    size_t rhs1_stride = stride_for_blas(m, k, rhs1_strides[1], rhs1_strides[2], rhs1_transposed);
+    size_t rhs2_stride = stride_for_blas(k, n, rhs2_strides[1], rhs2_strides[2], rhs2_transposed);
+
+    BatchedMatMulImplBody<KIND, CODE>()(batch,
+                                        m,
+                                        n,
+                                        k,
+                                        lhs,
+                                        rhs1,
+                                        rhs2,
+                                        lhs_strides[0],
+                                        lhs_strides[1],
+                                        rhs1_strides[0],
+                                        rhs1_stride,
+                                        rhs2_strides[0],
+                                        rhs2_stride,
+                                        rhs1_transposed,
+                                        rhs2_transposed);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_batched_matmul<CODE>::value>* = nullptr>
+  void operator()(BatchedMatMulArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+template <VariantKind KIND>
+static void batched_matmul_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& outputs = context.outputs();
+
+  BatchedMatMulArgs args{outputs[0], inputs[0], inputs[1]};
+  // Note that we can't dispatch on the lhs's type,
+  // as the lhs can have a different type than the rhs'
+  type_dispatch(args.rhs1.code(), BatchedMatMulImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
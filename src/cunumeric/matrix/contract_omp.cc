@@ -108,12 +108,12 @@ struct ContractImplBody<VariantKind::OMP, LegateTypeCode::HALF_LT> {
                   int32_t* rhs2_modes)
   {
     // TBLIS doesn't handle half-precision floating point directly, so we have to go through a
-    // conversion to single-precision.
+    // conversion to single-precision. The product is computed into a fresh single-precision buffer
+    // and then added to lhs, which saves converting lhs to single precision first.
 
     std::vector<int64_t> lhs_copy_strides(lhs_ndim);
     int64_t lhs_size     = calculate_volume(lhs_ndim, lhs_shape, lhs_copy_strides.data());
     float* lhs_copy_data = allocate_buffer_omp(lhs_size);
-    half_tensor_to_float_omp(lhs_copy_data, lhs_data, lhs_ndim, lhs_shape, lhs_strides);
 
     std::vector<int64_t> rhs1_copy_strides(rhs1_ndim);
     int64_t rhs1_size     = calculate_volume(rhs1_ndim, rhs1_shape, rhs1_copy_strides.data());
@@ -125,23 +125,20 @@ struct ContractImplBody<VariantKind::OMP, LegateTypeCode::HALF_LT> {
     float* rhs2_copy_data = allocate_buffer_omp(rhs2_size);
     half_tensor_to_float_omp(rhs2_copy_data, rhs2_data, rhs2_ndim, rhs2_shape, rhs2_strides);
 
-    ContractImplBody<VariantKind::OMP, LegateTypeCode::FLOAT_LT>{}(lhs_copy_data,
-                                                                   lhs_ndim,
-                                                                   lhs_shape,
-                                                                   lhs_copy_strides.data(),
-                                                                   lhs_modes,
-                                                                   rhs1_copy_data,
-                                                                   rhs1_ndim,
-                                                                   rhs1_shape,
-                                                                   rhs1_copy_strides.data(),
-                                                                   rhs1_modes,
-                                                                   rhs2_copy_data,
-                                                                   rhs2_ndim,
-                                                                   rhs2_shape,
-                                                                   rhs2_copy_strides.data(),
-                                                                   rhs2_modes);
-
-    float_tensor_to_half_omp(lhs_data, lhs_copy_data, lhs_ndim, lhs_shape, lhs_strides);
+    // A zero scaling factor makes TBLIS overwrite the uninitialized buffer instead of reading it
+    tblis_tensor lhs;
+    tblis_init_tensor_scaled_s(
+      &lhs, 0.0f, lhs_ndim, lhs_shape, lhs_copy_data, lhs_copy_strides.data());
+
+    tblis_tensor rhs1;
+    tblis_init_tensor_s(&rhs1, rhs1_ndim, rhs1_shape, rhs1_copy_data, rhs1_copy_strides.data());
+
+    tblis_tensor rhs2;
+    tblis_init_tensor_s(&rhs2, rhs2_ndim, rhs2_shape, rhs2_copy_data, rhs2_copy_strides.data());
+
+    tblis_tensor_mult(nullptr, nullptr, &rhs1, rhs1_modes, &rhs2, rhs2_modes, &lhs, lhs_modes);
+
+    add_float_tensor_to_half_omp(lhs_data, lhs_copy_data, lhs_ndim, lhs_shape, lhs_strides);
   }
 };
 
@@ -25,42 +25,67 @@ using namespace Legion;
 using namespace legate;
 
 template <typename Gemm, typename VAL>
-static inline void gemm_template(
-  Gemm gemm, VAL* lhs, const VAL* rhs1, const VAL* rhs2, int32_t m, int32_t n, int32_t k)
+static inline void gemm_template(Gemm gemm,
+                                 VAL* lhs,
+                                 const VAL* rhs1,
+                                 const VAL* rhs2,
+                                 int32_t m,
+                                 int32_t n,
+                                 int32_t k,
+                                 bool transpose_rhs2)
 {
   auto transa = CblasNoTrans;
-  auto transb = CblasTrans;
+  auto transb = transpose_rhs2 ? CblasTrans : CblasNoTrans;
+  auto ldb    = transpose_rhs2 ? n : k;
 
-  gemm(CblasColMajor, transa, transb, m, n, k, -1.0, rhs1, m, rhs2, n, 1.0, lhs, m);
+  gemm(CblasColMajor, transa, transb, m, n, k, -1.0, rhs1, m, rhs2, ldb, 1.0, lhs, m);
 }
 
 template <typename Gemm, typename VAL>
-static inline void complex_gemm_template(
-  Gemm gemm, VAL* lhs, const VAL* rhs1, const VAL* rhs2, int32_t m, int32_t n, int32_t k)
+static inline void complex_gemm_template(Gemm gemm,
+                                         VAL* lhs,
+                                         const VAL* rhs1,
+                                         const VAL* rhs2,
+                                         int32_t m,
+                                         int32_t n,
+                                         int32_t k,
+                                         bool transpose_rhs2)
 {
   auto transa = CblasNoTrans;
-  auto transb = CblasConjTrans;
+  auto transb = transpose_rhs2 ? CblasConjTrans : CblasNoTrans;
+  auto ldb    = transpose_rhs2 ? n : k;
 
   VAL alpha = -1.0;
   VAL beta  = 1.0;
 
-  gemm(CblasColMajor, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, n, &beta, lhs, m);
+  gemm(CblasColMajor, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, ldb, &beta, lhs, m);
 }
 
 template <>
 struct GemmImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
-  void operator()(float* lhs, const float* rhs1, const float* rhs2, int32_t m, int32_t n, int32_t k)
+  void operator()(float* lhs,
+                  const float* rhs1,
+                  const float* rhs2,
+                  int32_t m,
+                  int32_t n,
+                  int32_t k,
+                  bool transpose_rhs2)
   {
-    gemm_template(cblas_sgemm, lhs, rhs1, rhs2, m, n, k);
+    gemm_template(cblas_sgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
 template <>
 struct GemmImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
-  void operator()(
-    double* lhs, const double* rhs1, const double* rhs2, int32_t m, int32_t n, int32_t k)
+  void operator()(double* lhs,
+                  const double* rhs1,
+                  const double* rhs2,
+                  int32_t m,
+                  int32_t n,
+                  int32_t k,
+                  bool transpose_rhs2)
   {
-    gemm_template(cblas_dgemm, lhs, rhs1, rhs2, m, n, k);
+    gemm_template(cblas_dgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
@@ -71,13 +96,14 @@ struct GemmImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
                   const complex<float>* rhs2_,
                   int32_t m,
                   int32_t n,
-                  int32_t k)
+                  int32_t k,
+                  bool transpose_rhs2)
   {
     auto lhs  = reinterpret_cast<__complex__ float*>(lhs_);
     auto rhs1 = reinterpret_cast<const __complex__ float*>(rhs1_);
     auto rhs2 = reinterpret_cast<const __complex__ float*>(rhs2_);
 
-    complex_gemm_template(cblas_cgemm, lhs, rhs1, rhs2, m, n, k);
+    complex_gemm_template(cblas_cgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
@@ -88,13 +114,14 @@ struct GemmImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX128_LT> {
                   const complex<double>* rhs2_,
                   int32_t m,
                   int32_t n,
-                  int32_t k)
+                  int32_t k,
+                  bool transpose_rhs2)
   {
     auto lhs  = reinterpret_cast<__complex__ double*>(lhs_);
     auto rhs1 = reinterpret_cast<const __complex__ double*>(rhs1_);
     auto rhs2 = reinterpret_cast<const __complex__ double*>(rhs2_);
 
-    complex_gemm_template(cblas_zgemm, lhs, rhs1, rhs2, m, n, k);
+    complex_gemm_template(cblas_zgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
@@ -25,57 +25,83 @@ using namespace Legion;
 using namespace legate;
 
 template <typename Gemm, typename VAL>
-static inline void gemm_template(
-  Gemm gemm, VAL* lhs, const VAL* rhs1, const VAL* rhs2, int32_t m, int32_t n, int32_t k)
+static inline void gemm_template(Gemm gemm,
+                                 VAL* lhs,
+                                 const VAL* rhs1,
+                                 const VAL* rhs2,
+                                 int32_t m,
+                                 int32_t n,
+                                 int32_t k,
+                                 bool transpose_rhs2)
 {
   auto context = get_cublas();
   auto stream  = get_cached_stream();
   CHECK_CUBLAS(cublasSetStream(context, stream));
 
   auto transa = CUBLAS_OP_N;
-  auto transb = CUBLAS_OP_T;
+  auto transb = transpose_rhs2 ? CUBLAS_OP_T : CUBLAS_OP_N;
+  auto ldb    = transpose_rhs2 ? n : k;
 
   VAL alpha = -1.0;
   VAL beta  = 1.0;
 
-  CHECK_CUBLAS(gemm(context, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, n, &beta, lhs, m));
+  CHECK_CUBLAS(gemm(context, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, ldb, &beta, lhs, m));
 
   CHECK_CUDA_STREAM(stream);
 }
 
 template <typename Gemm, typename VAL, typename CTOR>
-static inline void complex_gemm_template(
-  Gemm gemm, VAL* lhs, const VAL* rhs1, const VAL* rhs2, int32_t m, int32_t n, int32_t k, CTOR ctor)
+static inline void complex_gemm_template(Gemm gemm,
+                                         VAL* lhs,
+                                         const VAL* rhs1,
+                                         const VAL* rhs2,
+                                         int32_t m,
+                                         int32_t n,
+                                         int32_t k,
+                                         bool transpose_rhs2,
+                                         CTOR ctor)
 {
   auto context = get_cublas();
   auto stream  = get_cached_stream();
   CHECK_CUBLAS(cublasSetStream(context, stream));
 
   auto transa = CUBLAS_OP_N;
-  auto transb = CUBLAS_OP_C;
+  auto transb = transpose_rhs2 ? CUBLAS_OP_C : CUBLAS_OP_N;
+  auto ldb    = transpose_rhs2 ? n : k;
 
   auto alpha = ctor(-1.0, 0.0);
   auto beta  = ctor(1.0, 0.0);
 
-  CHECK_CUBLAS(gemm(context, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, n, &beta, lhs, m));
+  CHECK_CUBLAS(gemm(context, transa, transb, m, n, k, &alpha, rhs1, m, rhs2, ldb, &beta, lhs, m));
 
   CHECK_CUDA_STREAM(stream);
 }
 
 template <>
 struct GemmImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
-  void operator()(float* lhs, const float* rhs1, const float* rhs2, int32_t m, int32_t n, int32_t k)
+  void operator()(float* lhs,
+                  const float* rhs1,
+                  const float* rhs2,
+                  int32_t m,
+                  int32_t n,
+                  int32_t k,
+                  bool transpose_rhs2)
   {
-    gemm_template(cublasSgemm, lhs, rhs1, rhs2, m, n, k);
+    gemm_template(cublasSgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
 template <>
 struct GemmImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
-  void operator()(
-    double* lhs, const double* rhs1, const double* rhs2, int32_t m, int32_t n, int32_t k)
+  void operator()(double* lhs,
+                  const double* rhs1,
+                  const double* rhs2,
+                  int32_t m,
+                  int32_t n,
+                  int32_t k,
+                  bool transpose_rhs2)
   {
-    gemm_template(cublasDgemm, lhs, rhs1, rhs2, m, n, k);
+    gemm_template(cublasDgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 };
 
@@ -86,13 +112,14 @@ struct GemmImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
                   const complex<float>* rhs2_,
                   int32_t m,
                   int32_t n,
-                  int32_t k)
+                  int32_t k,
+                  bool transpose_rhs2)
   {
     auto lhs  = reinterpret_cast<cuComplex*>(lhs_);
     auto rhs1 = reinterpret_cast<const cuComplex*>(rhs1_);
     auto rhs2 = reinterpret_cast<const cuComplex*>(rhs2_);
 
-    complex_gemm_template(cublasCgemm, lhs, rhs1, rhs2, m, n, k, make_float2);
+    complex_gemm_template(cublasCgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2, make_float2);
   }
 };
 
@@ -103,13 +130,14 @@ struct GemmImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
                   const complex<double>* rhs2_,
                   int32_t m,
                   int32_t n,
-                  int32_t k)
+                  int32_t k,
+                  bool transpose_rhs2)
   {
     auto lhs  = reinterpret_cast<cuDoubleComplex*>(lhs_);
     auto rhs1 = reinterpret_cast<const cuDoubleComplex*>(rhs1_);
     auto rhs2 = reinterpret_cast<const cuDoubleComplex*>(rhs2_);
 
-    complex_gemm_template(cublasZgemm, lhs, rhs1, rhs2, m, n, k, make_double2);
+    complex_gemm_template(cublasZgemm, lhs, rhs1, rhs2, m, n, k, transpose_rhs2, make_double2);
   }
 };
 
@@ -46,7 +46,10 @@ struct support_gemm<LegateTypeCode::COMPLEX128_LT> : std::true_type {
 template <VariantKind KIND>
 struct GemmImpl {
   template <LegateTypeCode CODE, std::enable_if_t<support_gemm<CODE>::value>* = nullptr>
-  void operator()(Array& lhs_array, Array& rhs1_array, Array& rhs2_array) const
+  void operator()(Array& lhs_array,
+                  Array& rhs1_array,
+                  Array& rhs2_array,
+                  bool transpose_rhs2) const
   {
     using VAL = legate_type_of<CODE>;
 
@@ -67,14 +70,17 @@ struct GemmImpl {
     auto m = static_cast<int32_t>(lhs_shape.hi[0] - lhs_shape.lo[0] + 1);
     auto n = static_cast<int32_t>(lhs_shape.hi[1] - lhs_shape.lo[1] + 1);
     auto k = static_cast<int32_t>(rhs1_shape.hi[1] - rhs1_shape.lo[1] + 1);
-    assert(rhs2_shape.hi[0] - rhs2_shape.lo[0] + 1 == n);
-    assert(rhs2_shape.hi[1] - rhs2_shape.lo[1] + 1 == k);
+    assert(rhs2_shape.hi[transpose_rhs2 ? 0 : 1] - rhs2_shape.lo[transpose_rhs2 ? 0 : 1] + 1 == n);
+    assert(rhs2_shape.hi[transpose_rhs2 ? 1 : 0] - rhs2_shape.lo[transpose_rhs2 ? 1 : 0] + 1 == k);
 
-    GemmImplBody<KIND, CODE>()(lhs, rhs1, rhs2, m, n, k);
+    GemmImplBody<KIND, CODE>()(lhs, rhs1, rhs2, m, n, k, transpose_rhs2);
   }
 
   template <LegateTypeCode CODE, std::enable_if_t<!support_gemm<CODE>::value>* = nullptr>
-  void operator()(Array& lhs_array, Array& rhs1_array, Array& rhs2_array) const
+  void operator()(Array& lhs_array,
+                  Array& rhs1_array,
+                  Array& rhs2_array,
+                  bool transpose_rhs2) const
   {
     assert(false);
   }
@@ -90,7 +96,12 @@ static void gemm_template(TaskContext& context)
   auto& rhs1 = inputs[0];
   auto& rhs2 = inputs[1];
 
-  type_dispatch(lhs.code(), GemmImpl<KIND>{}, lhs, rhs1, rhs2);
+  // Computes lhs -= rhs1 @ rhs2^H by default, as needed by Cholesky. The LU factorization
+  // passes an extra flag to compute lhs -= rhs1 @ rhs2 instead.
+  auto& scalars       = context.scalars();
+  bool transpose_rhs2 = scalars.empty() || scalars[0].value<bool>();
+
+  type_dispatch(lhs.code(), GemmImpl<KIND>{}, lhs, rhs1, rhs2, transpose_rhs2);
 }
 
 }  // namespace cunumeric
@@ -0,0 +1,151 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/geqrf.h"
+#include "cunumeric/matrix/geqrf_template.inl"
+
+#include <cblas.h>
+#include <lapack.h>
+#include <cstring>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+// Block size used to size the LAPACK workspaces
+static constexpr int32_t GEQRF_BLOCK_SIZE = 64;
+
+// The columns of b, if any, are factored along with those of a, so that the reflectors of a are
+// applied to them
+template <typename Geqrf, typename Orgqr, typename VAL>
+static inline void geqrf_template(Geqrf geqrf,
+                                  Orgqr orgqr,
+                                  const VAL* a,
+                                  const VAL* b,
+                                  VAL* r,
+                                  VAL* q,
+                                  int32_t m,
+                                  int32_t n,
+                                  int32_t nrhs)
+{
+  const int32_t na = n;
+  n += nrhs;
+
+  int32_t k     = std::min(m, n);
+  int32_t lwork = std::max(n, 1) * GEQRF_BLOCK_SIZE;
+  int32_t info  = 0;
+
+  auto buffer = create_buffer<VAL>(static_cast<size_t>(m) * n);
+  auto tau    = create_buffer<VAL>(k);
+  auto work   = create_buffer<VAL>(lwork);
+  auto qr     = buffer.ptr(0);
+
+  // LAPACK factorizes in place, but the input must be preserved
+  std::memcpy(qr, a, sizeof(VAL) * m * na);
+  if (nrhs > 0) std::memcpy(qr + static_cast<size_t>(m) * na, b, sizeof(VAL) * m * nrhs);
+
+  geqrf(&m, &n, qr, &m, tau.ptr(0), work.ptr(0), &lwork, &info);
+  if (info != 0) throw legate::TaskException("QR factorization failed");
+
+  for (int32_t col = 0; col < n; ++col)
+    for (int32_t row = 0; row < k; ++row)
+      r[row + col * k] = row <= col ? qr[row + col * m] : VAL(0);
+
+  if (q == nullptr) return;
+
+  orgqr(&m, &k, &k, qr, &m, tau.ptr(0), work.ptr(0), &lwork, &info);
+  if (info != 0) throw legate::TaskException("QR factorization failed");
+
+  std::memcpy(q, qr, sizeof(VAL) * m * k);
+}
+
+template <>
+struct GeqrfImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(
+    const float* a, const float* b, float* r, float* q, int32_t m, int32_t n, int32_t nrhs)
+  {
+    geqrf_template(sgeqrf_, sorgqr_, a, b, r, q, m, n, nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(
+    const double* a, const double* b, double* r, double* q, int32_t m, int32_t n, int32_t nrhs)
+  {
+    geqrf_template(dgeqrf_, dorgqr_, a, b, r, q, m, n, nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a,
+                  const complex<float>* b,
+                  complex<float>* r,
+                  complex<float>* q,
+                  int32_t m,
+                  int32_t n,
+                  int32_t nrhs)
+  {
+    geqrf_template(cgeqrf_,
+                   cungqr_,
+                   reinterpret_cast<const __complex__ float*>(a),
+                   reinterpret_cast<const __complex__ float*>(b),
+                   reinterpret_cast<__complex__ float*>(r),
+                   reinterpret_cast<__complex__ float*>(q),
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a,
+                  const complex<double>* b,
+                  complex<double>* r,
+                  complex<double>* q,
+                  int32_t m,
+                  int32_t n,
+                  int32_t nrhs)
+  {
+    geqrf_template(zgeqrf_,
+                   zungqr_,
+                   reinterpret_cast<const __complex__ double*>(a),
+                   reinterpret_cast<const __complex__ double*>(b),
+                   reinterpret_cast<__complex__ double*>(r),
+                   reinterpret_cast<__complex__ double*>(q),
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+/*static*/ void GeqrfTask::cpu_variant(TaskContext& context)
+{
+#ifdef LEGATE_USE_OPENMP
+  openblas_set_num_threads(1);  // make sure this isn't overzealous
+#endif
+  geqrf_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { GeqrfTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
@@ -0,0 +1,199 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/geqrf.h"
+#include "cunumeric/matrix/geqrf_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  extract_r(VAL* r, const VAL* qr, int32_t m, int32_t k, size_t volume)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  const int32_t row = idx % k;
+  const int32_t col = idx / k;
+  r[idx]            = row <= col ? qr[row + static_cast<size_t>(col) * m] : VAL{};
+}
+
+template <typename GeqrfBufferSize,
+          typename Geqrf,
+          typename OrgqrBufferSize,
+          typename Orgqr,
+          typename VAL>
+static inline void geqrf_template(GeqrfBufferSize geqrfBufferSize,
+                                  Geqrf geqrf,
+                                  OrgqrBufferSize orgqrBufferSize,
+                                  Orgqr orgqr,
+                                  const VAL* a,
+                                  const VAL* b,
+                                  VAL* r,
+                                  VAL* q,
+                                  int32_t m,
+                                  int32_t n,
+                                  int32_t nrhs)
+{
+  auto context = get_cusolver();
+  auto stream  = get_cached_stream();
+  CHECK_CUSOLVER(cusolverDnSetStream(context, stream));
+
+  // The columns of b, if any, are factored along with those of a, so that the reflectors of a
+  // are applied to them
+  const int32_t na = n;
+  n += nrhs;
+
+  int32_t k = std::min(m, n);
+
+  auto buffer = create_buffer<VAL>(static_cast<size_t>(m) * n, Memory::Kind::GPU_FB_MEM);
+  auto tau    = create_buffer<VAL>(k, Memory::Kind::GPU_FB_MEM);
+  auto info   = create_buffer<int32_t>(1, Memory::Kind::Z_COPY_MEM);
+  auto qr     = buffer.ptr(0);
+
+  // cuSOLVER factorizes in place, but the input must be preserved
+  CHECK_CUDA(cudaMemcpyAsync(qr, a, sizeof(VAL) * m * na, cudaMemcpyDeviceToDevice, stream));
+  if (nrhs > 0)
+    CHECK_CUDA(cudaMemcpyAsync(qr + static_cast<size_t>(m) * na,
+                               b,
+                               sizeof(VAL) * m * nrhs,
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+
+  int32_t bufferSize;
+  CHECK_CUSOLVER(geqrfBufferSize(context, m, n, qr, m, &bufferSize));
+  if (q != nullptr) {
+    int32_t orgqrSize;
+    CHECK_CUSOLVER(orgqrBufferSize(context, m, k, k, qr, m, tau.ptr(0), &orgqrSize));
+    bufferSize = std::max(bufferSize, orgqrSize);
+  }
+  auto work = create_buffer<VAL>(bufferSize, Memory::Kind::GPU_FB_MEM);
+
+  CHECK_CUSOLVER(geqrf(context, m, n, qr, m, tau.ptr(0), work.ptr(0), bufferSize, info.ptr(0)));
+
+  const size_t volume = static_cast<size_t>(k) * n;
+  const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+  extract_r<VAL><<<blocks, THREADS_PER_BLOCK, 0, stream>>>(r, qr, m, k, volume);
+
+  if (q != nullptr) {
+    CHECK_CUSOLVER(
+      orgqr(context, m, k, k, qr, m, tau.ptr(0), work.ptr(0), bufferSize, info.ptr(0)));
+    CHECK_CUDA(cudaMemcpyAsync(q, qr, sizeof(VAL) * m * k, cudaMemcpyDeviceToDevice, stream));
+  }
+
+  // TODO: We need a deferred exception to avoid this synchronization
+  CHECK_CUDA(cudaStreamSynchronize(stream));
+  CHECK_CUDA_STREAM(stream);
+
+  if (info[0] != 0) throw legate::TaskException("QR factorization failed");
+}
+
+template <>
+struct GeqrfImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(
+    const float* a, const float* b, float* r, float* q, int32_t m, int32_t n, int32_t nrhs)
+  {
+    geqrf_template(cusolverDnSgeqrf_bufferSize,
+                   cusolverDnSgeqrf,
+                   cusolverDnSorgqr_bufferSize,
+                   cusolverDnSorgqr,
+                   a,
+                   b,
+                   r,
+                   q,
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(
+    const double* a, const double* b, double* r, double* q, int32_t m, int32_t n, int32_t nrhs)
+  {
+    geqrf_template(cusolverDnDgeqrf_bufferSize,
+                   cusolverDnDgeqrf,
+                   cusolverDnDorgqr_bufferSize,
+                   cusolverDnDorgqr,
+                   a,
+                   b,
+                   r,
+                   q,
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a,
+                  const complex<float>* b,
+                  complex<float>* r,
+                  complex<float>* q,
+                  int32_t m,
+                  int32_t n,
+                  int32_t nrhs)
+  {
+    geqrf_template(cusolverDnCgeqrf_bufferSize,
+                   cusolverDnCgeqrf,
+                   cusolverDnCungqr_bufferSize,
+                   cusolverDnCungqr,
+                   reinterpret_cast<const cuComplex*>(a),
+                   reinterpret_cast<const cuComplex*>(b),
+                   reinterpret_cast<cuComplex*>(r),
+                   reinterpret_cast<cuComplex*>(q),
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+template <>
+struct GeqrfImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a,
+                  const complex<double>* b,
+                  complex<double>* r,
+                  complex<double>* q,
+                  int32_t m,
+                  int32_t n,
+                  int32_t nrhs)
+  {
+    geqrf_template(cusolverDnZgeqrf_bufferSize,
+                   cusolverDnZgeqrf,
+                   cusolverDnZungqr_bufferSize,
+                   cusolverDnZungqr,
+                   reinterpret_cast<const cuDoubleComplex*>(a),
+                   reinterpret_cast<const cuDoubleComplex*>(b),
+                   reinterpret_cast<cuDoubleComplex*>(r),
+                   reinterpret_cast<cuDoubleComplex*>(q),
+                   m,
+                   n,
+                   nrhs);
+  }
+};
+
+/*static*/ void GeqrfTask::gpu_variant(TaskContext& context)
+{
+  geqrf_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
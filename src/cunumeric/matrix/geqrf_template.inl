@@ -0,0 +1,116 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/geqrf.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct GeqrfImplBody;
+
+template <LegateTypeCode CODE>
+struct support_geqrf : std::false_type {
+};
+template <>
+struct support_geqrf<LegateTypeCode::DOUBLE_LT> : std::true_type {
+};
+template <>
+struct support_geqrf<LegateTypeCode::FLOAT_LT> : std::true_type {
+};
+template <>
+struct support_geqrf<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+};
+template <>
+struct support_geqrf<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+};
+
+template <VariantKind KIND>
+struct GeqrfImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_geqrf<CODE>::value>* = nullptr>
+  void operator()(Array& a_array, Array* b_array, Array& r_array, Array* q_array) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto a_shape = a_array.shape<2>();
+
+    if (a_shape.empty()) return;
+
+    size_t a_strides[2];
+    size_t r_strides[2];
+
+    auto r_shape = r_array.shape<2>();
+    auto a       = a_array.read_accessor<VAL, 2>(a_shape).ptr(a_shape, a_strides);
+    auto r       = r_array.write_accessor<VAL, 2>(r_shape).ptr(r_shape, r_strides);
+    auto m       = static_cast<int32_t>(a_shape.hi[0] - a_shape.lo[0] + 1);
+    auto n       = static_cast<int32_t>(a_shape.hi[1] - a_shape.lo[1] + 1);
+
+    const VAL* b = nullptr;
+    int32_t nrhs = 0;
+    if (b_array != nullptr) {
+      size_t b_strides[2];
+      auto b_shape = b_array->shape<2>();
+      b            = b_array->read_accessor<VAL, 2>(b_shape).ptr(b_shape, b_strides);
+      nrhs         = static_cast<int32_t>(b_shape.hi[1] - b_shape.lo[1] + 1);
+      assert(b_shape.hi[0] - b_shape.lo[0] + 1 == m);
+    }
+    assert(r_shape.hi[0] - r_shape.lo[0] + 1 == std::min(m, n + nrhs));
+    assert(r_shape.hi[1] - r_shape.lo[1] + 1 == n + nrhs);
+
+    VAL* q = nullptr;
+    if (q_array != nullptr) {
+      size_t q_strides[2];
+      auto q_shape = q_array->shape<2>();
+      q            = q_array->write_accessor<VAL, 2>(q_shape).ptr(q_shape, q_strides);
+      assert(q_shape.hi[0] - q_shape.lo[0] + 1 == m);
+      assert(q_shape.hi[1] - q_shape.lo[1] + 1 == std::min(m, n));
+      assert(b == nullptr);
+    }
+
+    GeqrfImplBody<KIND, CODE>()(a, b, r, q, m, n, nrhs);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_geqrf<CODE>::value>* = nullptr>
+  void operator()(Array& a_array, Array* b_array, Array& r_array, Array* q_array) const
+  {
+    assert(false);
+  }
+};
+
+// Computes the reduced QR factorization of an m x n matrix, i.e., an upper trapezoidal
+// min(m, n) x n factor R and, when a second output is passed, the m x min(m, n) factor Q
+// with orthonormal columns. The tall-skinny QR driver uses it both on row blocks and on
+// the stacked R factors of those blocks. A second input b with the same rows is factored as
+// the trailing columns of [a | b], which gives the R factor of the augmented matrix without
+// forming Q; least squares solvers take Q^H b from its top rows.
+template <VariantKind KIND>
+static void geqrf_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& outputs = context.outputs();
+  auto& a       = inputs[0];
+  auto* b       = inputs.size() > 1 ? &inputs[1] : nullptr;
+  auto& r       = outputs[0];
+  auto* q       = outputs.size() > 1 ? &outputs[1] : nullptr;
+  type_dispatch(a.code(), GeqrfImpl<KIND>{}, a, b, r, q);
+}
+
+}  // namespace cunumeric
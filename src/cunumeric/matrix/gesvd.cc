@@ -0,0 +1,172 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/gesvd.h"
+#include "cunumeric/matrix/gesvd_template.inl"
+
+#include <cblas.h>
+#include <lapack.h>
+#include <cstring>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename Gesvd, typename VAL, typename RVAL>
+static inline void gesvd_template(
+  Gesvd gesvd, const VAL* a, RVAL* s, VAL* u, VAL* vh, int32_t m, int32_t n, bool full_matrices)
+{
+  char jobu     = u == nullptr ? 'N' : (full_matrices ? 'A' : 'S');
+  char jobvt    = vh == nullptr ? 'N' : 'A';
+  int32_t ldu   = u == nullptr ? 1 : m;
+  int32_t ldvt  = vh == nullptr ? 1 : n;
+  int32_t lwork = std::max(3 * n + m, 5 * n);
+  int32_t info  = 0;
+
+  auto buffer = create_buffer<VAL>(static_cast<size_t>(m) * n);
+  auto work   = create_buffer<VAL>(lwork);
+
+  // LAPACK destroys the input, which must be preserved
+  std::memcpy(buffer.ptr(0), a, sizeof(VAL) * m * n);
+
+  gesvd(&jobu,
+        &jobvt,
+        &m,
+        &n,
+        buffer.ptr(0),
+        &m,
+        s,
+        u,
+        &ldu,
+        vh,
+        &ldvt,
+        work.ptr(0),
+        &lwork,
+        &info);
+  if (info != 0) throw legate::TaskException("SVD did not converge");
+}
+
+template <typename Gesvd, typename VAL, typename RVAL>
+static inline void complex_gesvd_template(
+  Gesvd gesvd, const VAL* a, RVAL* s, VAL* u, VAL* vh, int32_t m, int32_t n, bool full_matrices)
+{
+  char jobu     = u == nullptr ? 'N' : (full_matrices ? 'A' : 'S');
+  char jobvt    = vh == nullptr ? 'N' : 'A';
+  int32_t ldu   = u == nullptr ? 1 : m;
+  int32_t ldvt  = vh == nullptr ? 1 : n;
+  int32_t lwork = 2 * n + m;
+  int32_t info  = 0;
+
+  auto buffer = create_buffer<VAL>(static_cast<size_t>(m) * n);
+  auto work   = create_buffer<VAL>(lwork);
+  auto rwork  = create_buffer<RVAL>(5 * n);
+
+  // LAPACK destroys the input, which must be preserved
+  std::memcpy(buffer.ptr(0), a, sizeof(VAL) * m * n);
+
+  gesvd(&jobu,
+        &jobvt,
+        &m,
+        &n,
+        buffer.ptr(0),
+        &m,
+        s,
+        u,
+        &ldu,
+        vh,
+        &ldvt,
+        work.ptr(0),
+        &lwork,
+        rwork.ptr(0),
+        &info);
+  if (info != 0) throw legate::TaskException("SVD did not converge");
+}
+
+template <>
+struct GesvdImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(
+    const float* a, float* s, float* u, float* vh, int32_t m, int32_t n, bool full_matrices)
+  {
+    gesvd_template(sgesvd_, a, s, u, vh, m, n, full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(
+    const double* a, double* s, double* u, double* vh, int32_t m, int32_t n, bool full_matrices)
+  {
+    gesvd_template(dgesvd_, a, s, u, vh, m, n, full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a,
+                  float* s,
+                  complex<float>* u,
+                  complex<float>* vh,
+                  int32_t m,
+                  int32_t n,
+                  bool full_matrices)
+  {
+    complex_gesvd_template(cgesvd_,
+                           reinterpret_cast<const __complex__ float*>(a),
+                           s,
+                           reinterpret_cast<__complex__ float*>(u),
+                           reinterpret_cast<__complex__ float*>(vh),
+                           m,
+                           n,
+                           full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a,
+                  double* s,
+                  complex<double>* u,
+                  complex<double>* vh,
+                  int32_t m,
+                  int32_t n,
+                  bool full_matrices)
+  {
+    complex_gesvd_template(zgesvd_,
+                           reinterpret_cast<const __complex__ double*>(a),
+                           s,
+                           reinterpret_cast<__complex__ double*>(u),
+                           reinterpret_cast<__complex__ double*>(vh),
+                           m,
+                           n,
+                           full_matrices);
+  }
+};
+
+/*static*/ void GesvdTask::cpu_variant(TaskContext& context)
+{
+#ifdef LEGATE_USE_OPENMP
+  openblas_set_num_threads(1);  // make sure this isn't overzealous
+#endif
+  gesvd_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { GesvdTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
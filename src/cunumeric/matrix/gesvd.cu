@@ -0,0 +1,153 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/gesvd.h"
+#include "cunumeric/matrix/gesvd_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename GesvdBufferSize, typename Gesvd, typename VAL, typename RVAL>
+static inline void gesvd_template(GesvdBufferSize gesvdBufferSize,
+                                  Gesvd gesvd,
+                                  const VAL* a,
+                                  RVAL* s,
+                                  VAL* u,
+                                  VAL* vh,
+                                  int32_t m,
+                                  int32_t n,
+                                  bool full_matrices)
+{
+  auto context = get_cusolver();
+  auto stream  = get_cached_stream();
+  CHECK_CUSOLVER(cusolverDnSetStream(context, stream));
+
+  signed char jobu  = u == nullptr ? 'N' : (full_matrices ? 'A' : 'S');
+  signed char jobvt = vh == nullptr ? 'N' : 'A';
+  int32_t ldu       = u == nullptr ? 1 : m;
+  int32_t ldvt      = vh == nullptr ? 1 : n;
+
+  auto buffer = create_buffer<VAL>(static_cast<size_t>(m) * n, Memory::Kind::GPU_FB_MEM);
+  auto rwork  = create_buffer<RVAL>(n, Memory::Kind::GPU_FB_MEM);
+  auto info   = create_buffer<int32_t>(1, Memory::Kind::Z_COPY_MEM);
+
+  // cuSOLVER destroys the input, which must be preserved
+  CHECK_CUDA(
+    cudaMemcpyAsync(buffer.ptr(0), a, sizeof(VAL) * m * n, cudaMemcpyDeviceToDevice, stream));
+
+  int32_t bufferSize;
+  CHECK_CUSOLVER(gesvdBufferSize(context, m, n, &bufferSize));
+
+  auto work = create_buffer<VAL>(bufferSize, Memory::Kind::GPU_FB_MEM);
+
+  CHECK_CUSOLVER(gesvd(context,
+                       jobu,
+                       jobvt,
+                       m,
+                       n,
+                       buffer.ptr(0),
+                       m,
+                       s,
+                       u,
+                       ldu,
+                       vh,
+                       ldvt,
+                       work.ptr(0),
+                       bufferSize,
+                       rwork.ptr(0),
+                       info.ptr(0)));
+
+  // TODO: We need a deferred exception to avoid this synchronization
+  CHECK_CUDA(cudaStreamSynchronize(stream));
+  CHECK_CUDA_STREAM(stream);
+
+  if (info[0] != 0) throw legate::TaskException("SVD did not converge");
+}
+
+template <>
+struct GesvdImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(
+    const float* a, float* s, float* u, float* vh, int32_t m, int32_t n, bool full_matrices)
+  {
+    gesvd_template(
+      cusolverDnSgesvd_bufferSize, cusolverDnSgesvd, a, s, u, vh, m, n, full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(
+    const double* a, double* s, double* u, double* vh, int32_t m, int32_t n, bool full_matrices)
+  {
+    gesvd_template(
+      cusolverDnDgesvd_bufferSize, cusolverDnDgesvd, a, s, u, vh, m, n, full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a,
+                  float* s,
+                  complex<float>* u,
+                  complex<float>* vh,
+                  int32_t m,
+                  int32_t n,
+                  bool full_matrices)
+  {
+    gesvd_template(cusolverDnCgesvd_bufferSize,
+                   cusolverDnCgesvd,
+                   reinterpret_cast<const cuComplex*>(a),
+                   s,
+                   reinterpret_cast<cuComplex*>(u),
+                   reinterpret_cast<cuComplex*>(vh),
+                   m,
+                   n,
+                   full_matrices);
+  }
+};
+
+template <>
+struct GesvdImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a,
+                  double* s,
+                  complex<double>* u,
+                  complex<double>* vh,
+                  int32_t m,
+                  int32_t n,
+                  bool full_matrices)
+  {
+    gesvd_template(cusolverDnZgesvd_bufferSize,
+                   cusolverDnZgesvd,
+                   reinterpret_cast<const cuDoubleComplex*>(a),
+                   s,
+                   reinterpret_cast<cuDoubleComplex*>(u),
+                   reinterpret_cast<cuDoubleComplex*>(vh),
+                   m,
+                   n,
+                   full_matrices);
+  }
+};
+
+/*static*/ void GesvdTask::gpu_variant(TaskContext& context)
+{
+  gesvd_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,118 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/gesvd.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct GesvdImplBody;
+
+template <LegateTypeCode CODE>
+struct support_gesvd : std::false_type {
+};
+template <>
+struct support_gesvd<LegateTypeCode::DOUBLE_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::DOUBLE_LT;
+};
+template <>
+struct support_gesvd<LegateTypeCode::FLOAT_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::FLOAT_LT;
+};
+template <>
+struct support_gesvd<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::FLOAT_LT;
+};
+template <>
+struct support_gesvd<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::DOUBLE_LT;
+};
+
+template <VariantKind KIND>
+struct GesvdImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_gesvd<CODE>::value>* = nullptr>
+  void operator()(Array& a_array,
+                  Array& s_array,
+                  Array* u_array,
+                  Array* vh_array,
+                  bool full_matrices) const
+  {
+    using VAL  = legate_type_of<CODE>;
+    using RVAL = legate_type_of<support_gesvd<CODE>::REAL_CODE>;
+
+    auto a_shape = a_array.shape<2>();
+
+    if (a_shape.empty()) return;
+
+    size_t a_strides[2];
+
+    auto s_shape = s_array.shape<1>();
+    auto a       = a_array.read_accessor<VAL, 2>(a_shape).ptr(a_shape, a_strides);
+    auto s       = s_array.write_accessor<RVAL, 1>(s_shape).ptr(s_shape);
+    auto m       = static_cast<int32_t>(a_shape.hi[0] - a_shape.lo[0] + 1);
+    auto n       = static_cast<int32_t>(a_shape.hi[1] - a_shape.lo[1] + 1);
+    assert(m >= n);
+    assert(s_shape.volume() == n);
+
+    VAL* u  = nullptr;
+    VAL* vh = nullptr;
+    if (u_array != nullptr) {
+      size_t u_strides[2];
+      size_t vh_strides[2];
+      auto u_shape  = u_array->shape<2>();
+      auto vh_shape = vh_array->shape<2>();
+      u             = u_array->write_accessor<VAL, 2>(u_shape).ptr(u_shape, u_strides);
+      vh            = vh_array->write_accessor<VAL, 2>(vh_shape).ptr(vh_shape, vh_strides);
+      assert(u_shape.volume() == static_cast<size_t>(m) * (full_matrices ? m : n));
+      assert(vh_shape.volume() == static_cast<size_t>(n) * n);
+    }
+
+    GesvdImplBody<KIND, CODE>()(a, s, u, vh, m, n, full_matrices);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_gesvd<CODE>::value>* = nullptr>
+  void operator()(Array& a_array,
+                  Array& s_array,
+                  Array* u_array,
+                  Array* vh_array,
+                  bool full_matrices) const
+  {
+    assert(false);
+  }
+};
+
+// Computes the singular values in descending order and, when two more outputs are passed,
+// the singular vectors of an m x n matrix with m >= n. Wide matrices are handled by the
+// caller through their conjugate transpose, as not all solver libraries support them.
+template <VariantKind KIND>
+static void gesvd_template(TaskContext& context)
+{
+  auto& outputs      = context.outputs();
+  auto& a            = context.inputs()[0];
+  auto& s            = outputs[0];
+  auto* u            = outputs.size() > 1 ? &outputs[1] : nullptr;
+  auto* vh           = outputs.size() > 1 ? &outputs[2] : nullptr;
+  auto full_matrices = context.scalars()[0].value<bool>();
+  type_dispatch(a.code(), GesvdImpl<KIND>{}, a, s, u, vh, full_matrices);
+}
+
+}  // namespace cunumeric
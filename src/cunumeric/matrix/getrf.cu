@@ -0,0 +1,116 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/getrf.h"
+#include "cunumeric/matrix/getrf_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  offset_pivots(int32_t* pivots, int32_t n, int64_t offset)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= n) return;
+  // cuSOLVER pivots are 1-based and relative to the first row of the panel
+  pivots[idx] += offset - 1;
+}
+
+template <typename GetrfBufferSize, typename Getrf, typename VAL>
+static inline void getrf_template(GetrfBufferSize getrfBufferSize,
+                                  Getrf getrf,
+                                  VAL* array,
+                                  int32_t* pivots,
+                                  int32_t m,
+                                  int32_t n,
+                                  int64_t offset)
+{
+  auto context = get_cusolver();
+  auto stream  = get_cached_stream();
+  CHECK_CUSOLVER(cusolverDnSetStream(context, stream));
+
+  int32_t bufferSize;
+  CHECK_CUSOLVER(getrfBufferSize(context, m, n, array, m, &bufferSize));
+
+  auto buffer = create_buffer<VAL>(bufferSize, Memory::Kind::GPU_FB_MEM);
+  auto info   = create_buffer<int32_t>(1, Memory::Kind::Z_COPY_MEM);
+
+  CHECK_CUSOLVER(getrf(context, m, n, array, m, buffer.ptr(0), pivots, info.ptr(0)));
+
+  const size_t blocks = (n + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+  offset_pivots<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(pivots, n, offset);
+
+  // TODO: We need a deferred exception to avoid this synchronization
+  CHECK_CUDA(cudaStreamSynchronize(stream));
+  CHECK_CUDA_STREAM(stream);
+
+  if (info[0] != 0) throw legate::TaskException("Singular matrix");
+}
+
+template <>
+struct GetrfImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(float* array, int32_t* pivots, int32_t m, int32_t n, int64_t offset)
+  {
+    getrf_template(cusolverDnSgetrf_bufferSize, cusolverDnSgetrf, array, pivots, m, n, offset);
+  }
+};
+
+template <>
+struct GetrfImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(double* array, int32_t* pivots, int32_t m, int32_t n, int64_t offset)
+  {
+    getrf_template(cusolverDnDgetrf_bufferSize, cusolverDnDgetrf, array, pivots, m, n, offset);
+  }
+};
+
+template <>
+struct GetrfImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(complex<float>* array, int32_t* pivots, int32_t m, int32_t n, int64_t offset)
+  {
+    getrf_template(cusolverDnCgetrf_bufferSize,
+                   cusolverDnCgetrf,
+                   reinterpret_cast<cuComplex*>(array),
+                   pivots,
+                   m,
+                   n,
+                   offset);
+  }
+};
+
+template <>
+struct GetrfImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(complex<double>* array, int32_t* pivots, int32_t m, int32_t n, int64_t offset)
+  {
+    getrf_template(cusolverDnZgetrf_bufferSize,
+                   cusolverDnZgetrf,
+                   reinterpret_cast<cuDoubleComplex*>(array),
+                   pivots,
+                   m,
+                   n,
+                   offset);
+  }
+};
+
+/*static*/ void GetrfTask::gpu_variant(TaskContext& context)
+{
+  getrf_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
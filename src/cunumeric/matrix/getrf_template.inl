@@ -0,0 +1,89 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/getrf.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct GetrfImplBody;
+
+template <LegateTypeCode CODE>
+struct support_getrf : std::false_type {
+};
+template <>
+struct support_getrf<LegateTypeCode::DOUBLE_LT> : std::true_type {
+};
+template <>
+struct support_getrf<LegateTypeCode::FLOAT_LT> : std::true_type {
+};
+template <>
+struct support_getrf<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+};
+template <>
+struct support_getrf<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+};
+
+template <VariantKind KIND>
+struct GetrfImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_getrf<CODE>::value>* = nullptr>
+  void operator()(Array& array, Array& pivots_array, int64_t offset) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto shape        = array.shape<2>();
+    auto pivots_shape = pivots_array.shape<1>();
+
+    if (shape.empty()) return;
+
+    size_t strides[2];
+
+    auto arr    = array.write_accessor<VAL, 2>(shape).ptr(shape, strides);
+    auto pivots = pivots_array.write_accessor<int32_t, 1>(pivots_shape).ptr(pivots_shape);
+    auto m      = static_cast<int32_t>(shape.hi[0] - shape.lo[0] + 1);
+    auto n      = static_cast<int32_t>(shape.hi[1] - shape.lo[1] + 1);
+    assert(m >= n && n > 0);
+    assert(pivots_shape.volume() == n);
+
+    GetrfImplBody<KIND, CODE>()(arr, pivots, m, n, offset);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_getrf<CODE>::value>* = nullptr>
+  void operator()(Array& array, Array& pivots_array, int64_t offset) const
+  {
+    assert(false);
+  }
+};
+
+// Factors an m x n (m >= n) column panel with partial pivoting. The pivots are stored as
+// 0-based row indices, shifted by the offset of the panel's first row in the whole matrix.
+template <VariantKind KIND>
+static void getrf_template(TaskContext& context)
+{
+  auto& outputs = context.outputs();
+  auto& array   = outputs[0];
+  auto& pivots  = outputs[1];
+  auto offset   = context.scalars()[0].value<int64_t>();
+  type_dispatch(array.code(), GetrfImpl<KIND>{}, array, pivots, offset);
+}
+
+}  // namespace cunumeric
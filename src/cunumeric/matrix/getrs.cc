@@ -0,0 +1,150 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/getrs.h"
+#include "cunumeric/matrix/getrs_template.inl"
+
+#include <cblas.h>
+#include <lapack.h>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL>
+static inline void swap_rows(
+  VAL* rhs, const int32_t* pivots, int32_t m, int32_t nrhs, int32_t num_pivots, int64_t offset)
+{
+  for (int32_t col = 0; col < nrhs; ++col) {
+    VAL* column = rhs + static_cast<size_t>(col) * m;
+    for (int32_t row = 0; row < num_pivots; ++row) {
+      auto other = static_cast<int32_t>(pivots[row] - offset);
+      assert(other >= row && other < m);
+      if (other != row) std::swap(column[row], column[other]);
+    }
+  }
+}
+
+template <typename Trsm, typename VAL, typename ALPHA>
+static inline void getrs_template(Trsm trsm,
+                                  VAL* rhs,
+                                  const VAL* lu,
+                                  const int32_t* pivots,
+                                  int32_t m,
+                                  int32_t nrhs,
+                                  int32_t ld,
+                                  int32_t n,
+                                  int32_t num_pivots,
+                                  const GetrsArgs& args,
+                                  ALPHA alpha)
+{
+  if (args.pivot) swap_rows(rhs, pivots, m, nrhs, num_pivots, args.offset);
+  auto side   = CblasLeft;
+  auto transa = CblasNoTrans;
+
+  if (args.lower)
+    trsm(CblasColMajor, side, CblasLower, transa, CblasUnit, n, nrhs, alpha, lu, ld, rhs, m);
+  if (args.upper)
+    trsm(CblasColMajor, side, CblasUpper, transa, CblasNonUnit, n, nrhs, alpha, lu, ld, rhs, m);
+}
+
+template <>
+struct GetrsImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(float* rhs,
+                  const float* lu,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    getrs_template(cblas_strsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, 1.0F);
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(double* rhs,
+                  const double* lu,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    getrs_template(cblas_dtrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, 1.0);
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(complex<float>* rhs_,
+                  const complex<float>* lu_,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    auto rhs = reinterpret_cast<__complex__ float*>(rhs_);
+    auto lu  = reinterpret_cast<const __complex__ float*>(lu_);
+
+    __complex__ float alpha = 1.0;
+    getrs_template(cblas_ctrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, &alpha);
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(complex<double>* rhs_,
+                  const complex<double>* lu_,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    auto rhs = reinterpret_cast<__complex__ double*>(rhs_);
+    auto lu  = reinterpret_cast<const __complex__ double*>(lu_);
+
+    __complex__ double alpha = 1.0;
+    getrs_template(cblas_ztrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, &alpha);
+  }
+};
+
+/*static*/ void GetrsTask::cpu_variant(TaskContext& context)
+{
+#ifdef LEGATE_USE_OPENMP
+  openblas_set_num_threads(1);  // make sure this isn't overzealous
+#endif
+  getrs_template<VariantKind::CPU>(context);
+}
+
+namespace  // unnamed
+{
+static void __attribute__((constructor)) register_tasks(void) { GetrsTask::register_variants(); }
+}  // namespace
+
+}  // namespace cunumeric
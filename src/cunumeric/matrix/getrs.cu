@@ -0,0 +1,178 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/getrs.h"
+#include "cunumeric/matrix/getrs_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename VAL>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  swap_rows(
+    VAL* rhs, const int32_t* pivots, int32_t m, int32_t nrhs, int32_t num_pivots, int64_t offset)
+{
+  const size_t col = global_tid_1d();
+  if (col >= nrhs) return;
+  VAL* column = rhs + col * m;
+  for (int32_t row = 0; row < num_pivots; ++row) {
+    auto other = static_cast<int32_t>(pivots[row] - offset);
+    if (other != row) {
+      VAL tmp       = column[row];
+      column[row]   = column[other];
+      column[other] = tmp;
+    }
+  }
+}
+
+template <typename Trsm, typename VAL>
+static inline void getrs_template(Trsm trsm,
+                                  VAL* rhs,
+                                  const VAL* lu,
+                                  const int32_t* pivots,
+                                  int32_t m,
+                                  int32_t nrhs,
+                                  int32_t ld,
+                                  int32_t n,
+                                  int32_t num_pivots,
+                                  const GetrsArgs& args,
+                                  VAL alpha)
+{
+  auto context = get_cublas();
+  auto stream  = get_cached_stream();
+  CHECK_CUBLAS(cublasSetStream(context, stream));
+
+  if (args.pivot) {
+    const size_t blocks = (nrhs + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    swap_rows<VAL>
+      <<<blocks, THREADS_PER_BLOCK, 0, stream>>>(rhs, pivots, m, nrhs, num_pivots, args.offset);
+  }
+
+  auto side   = CUBLAS_SIDE_LEFT;
+  auto transa = CUBLAS_OP_N;
+
+  if (args.lower)
+    CHECK_CUBLAS(trsm(context,
+                      side,
+                      CUBLAS_FILL_MODE_LOWER,
+                      transa,
+                      CUBLAS_DIAG_UNIT,
+                      n,
+                      nrhs,
+                      &alpha,
+                      lu,
+                      ld,
+                      rhs,
+                      m));
+  if (args.upper)
+    CHECK_CUBLAS(trsm(context,
+                      side,
+                      CUBLAS_FILL_MODE_UPPER,
+                      transa,
+                      CUBLAS_DIAG_NON_UNIT,
+                      n,
+                      nrhs,
+                      &alpha,
+                      lu,
+                      ld,
+                      rhs,
+                      m));
+
+  CHECK_CUDA_STREAM(stream);
+}
+
+template <>
+struct GetrsImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(float* rhs,
+                  const float* lu,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    getrs_template(cublasStrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, 1.0F);
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(double* rhs,
+                  const double* lu,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    getrs_template(cublasDtrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, 1.0);
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(complex<float>* rhs_,
+                  const complex<float>* lu_,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    auto rhs = reinterpret_cast<cuComplex*>(rhs_);
+    auto lu  = reinterpret_cast<const cuComplex*>(lu_);
+
+    getrs_template(
+      cublasCtrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, make_float2(1.0, 0.0));
+  }
+};
+
+template <>
+struct GetrsImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(complex<double>* rhs_,
+                  const complex<double>* lu_,
+                  const int32_t* pivots,
+                  int32_t m,
+                  int32_t nrhs,
+                  int32_t ld,
+                  int32_t n,
+                  int32_t num_pivots,
+                  const GetrsArgs& args)
+  {
+    auto rhs = reinterpret_cast<cuDoubleComplex*>(rhs_);
+    auto lu  = reinterpret_cast<const cuDoubleComplex*>(lu_);
+
+    getrs_template(
+      cublasZtrsm, rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args, make_double2(1.0, 0.0));
+  }
+};
+
+/*static*/ void GetrsTask::gpu_variant(TaskContext& context)
+{
+  getrs_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,136 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/getrs.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+struct GetrsArgs {
+  // Apply the row interchanges recorded in the pivots before any solve
+  bool pivot;
+  // Solve with the unit lower triangular factor
+  bool lower;
+  // Solve with the upper triangular factor
+  bool upper;
+  // Row of the whole matrix that corresponds to the first row of the right-hand sides
+  int64_t offset;
+};
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct GetrsImplBody;
+
+template <LegateTypeCode CODE>
+struct support_getrs : std::false_type {
+};
+template <>
+struct support_getrs<LegateTypeCode::DOUBLE_LT> : std::true_type {
+};
+template <>
+struct support_getrs<LegateTypeCode::FLOAT_LT> : std::true_type {
+};
+template <>
+struct support_getrs<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+};
+template <>
+struct support_getrs<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+};
+
+template <VariantKind KIND>
+struct GetrsImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_getrs<CODE>::value>* = nullptr>
+  void operator()(Array& rhs_array,
+                  Array* lu_array,
+                  Array* pivots_array,
+                  const GetrsArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto rhs_shape = rhs_array.shape<2>();
+
+    if (rhs_shape.empty()) return;
+
+    size_t rhs_strides[2];
+
+    auto rhs = rhs_array.write_accessor<VAL, 2>(rhs_shape).ptr(rhs_shape, rhs_strides);
+
+    auto m    = static_cast<int32_t>(rhs_shape.hi[0] - rhs_shape.lo[0] + 1);
+    auto nrhs = static_cast<int32_t>(rhs_shape.hi[1] - rhs_shape.lo[1] + 1);
+
+    const VAL* lu = nullptr;
+    int32_t ld    = 1;
+    int32_t n     = 0;
+    if (args.lower || args.upper) {
+      size_t lu_strides[2];
+      auto lu_shape = lu_array->shape<2>();
+      lu            = lu_array->read_accessor<VAL, 2>(lu_shape).ptr(lu_shape, lu_strides);
+      ld            = static_cast<int32_t>(lu_shape.hi[0] - lu_shape.lo[0] + 1);
+      n             = static_cast<int32_t>(lu_shape.hi[1] - lu_shape.lo[1] + 1);
+      assert(m >= n && ld >= n);
+    }
+
+    const int32_t* pivots = nullptr;
+    int32_t num_pivots    = 0;
+    if (args.pivot) {
+      auto pivots_shape = pivots_array->shape<1>();
+      pivots     = pivots_array->read_accessor<int32_t, 1>(pivots_shape).ptr(pivots_shape);
+      num_pivots = static_cast<int32_t>(pivots_shape.volume());
+      assert(m >= num_pivots);
+    }
+
+    GetrsImplBody<KIND, CODE>()(rhs, lu, pivots, m, nrhs, ld, n, num_pivots, args);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_getrs<CODE>::value>* = nullptr>
+  void operator()(Array& rhs_array,
+                  Array* lu_array,
+                  Array* pivots_array,
+                  const GetrsArgs& args) const
+  {
+    assert(false);
+  }
+};
+
+// Applies an LU factorization computed by GETRF to a block of right-hand sides. Depending on
+// the flags, this applies the row interchanges and/or solves with either triangular factor,
+// which is all the tiled LU and triangular solve drivers need. The factor is only passed
+// when one of the solves is requested and the pivots only when they are applied.
+template <VariantKind KIND>
+static void getrs_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& scalars = context.scalars();
+
+  GetrsArgs args;
+  args.pivot  = scalars[0].value<bool>();
+  args.lower  = scalars[1].value<bool>();
+  args.upper  = scalars[2].value<bool>();
+  args.offset = scalars[3].value<int64_t>();
+
+  uint32_t idx = 0;
+  auto& rhs    = context.outputs()[0];
+  auto* lu     = (args.lower || args.upper) ? &inputs[idx++] : nullptr;
+  auto* pivots = args.pivot ? &inputs[idx++] : nullptr;
+
+  type_dispatch(rhs.code(), GetrsImpl<KIND>{}, rhs, lu, pivots, args);
+}
+
+}  // namespace cunumeric
@@ -40,7 +40,8 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cblas_sgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -53,7 +54,7 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::FLOAT_LT> {
                 rhs1_stride,
                 rhs2,
                 rhs2_stride,
-                0,
+                accumulate ? 1 : 0,
                 lhs,
                 lhs_stride);
   }
@@ -71,7 +72,8 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cblas_dgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -84,7 +86,7 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::DOUBLE_LT> {
                 rhs1_stride,
                 rhs2,
                 rhs2_stride,
-                0,
+                accumulate ? 1 : 0,
                 lhs,
                 lhs_stride);
   }
@@ -102,7 +104,8 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::HALF_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     auto rhs1_copy = allocate_buffer(m * k);
     auto rhs2_copy = allocate_buffer(k * n);
@@ -128,12 +131,33 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::HALF_LT> {
                 rhs1_transposed ? m : k,
                 rhs2_copy,
                 rhs2_transposed ? k : n,
-                0,
+                accumulate ? 1 : 0,
                 lhs,
                 lhs_stride);
   }
 };
 
+template <>
+struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::INT8_LT> {
+  void operator()(size_t m,
+                  size_t n,
+                  size_t k,
+                  int32_t* lhs,
+                  const int8_t* rhs1,
+                  const int8_t* rhs2,
+                  size_t lhs_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed,
+                  bool accumulate)
+  {
+    auto rhs2_copy = widen_int8_matrix(rhs2, k, n, rhs2_stride, rhs2_transposed);
+    int8_gemm_rows(
+      0, m, n, k, lhs, rhs1, rhs2_copy, lhs_stride, rhs1_stride, rhs1_transposed, accumulate);
+  }
+};
+
 template <>
 struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
   void operator()(size_t m,
@@ -146,13 +170,14 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX64_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     __complex__ float* lhs        = reinterpret_cast<__complex__ float*>(lhs_);
     const __complex__ float* rhs1 = reinterpret_cast<const __complex__ float*>(rhs1_);
     const __complex__ float* rhs2 = reinterpret_cast<const __complex__ float*>(rhs2_);
     __complex__ float alpha       = 1.0;
-    __complex__ float beta        = 0.0;
+    __complex__ float beta        = accumulate ? 1.0 : 0.0;
 
     cblas_cgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -183,13 +208,14 @@ struct MatMulImplBody<VariantKind::CPU, LegateTypeCode::COMPLEX128_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     __complex__ double* lhs        = reinterpret_cast<__complex__ double*>(lhs_);
     const __complex__ double* rhs1 = reinterpret_cast<const __complex__ double*>(rhs1_);
     const __complex__ double* rhs2 = reinterpret_cast<const __complex__ double*>(rhs2_);
     __complex__ double alpha       = 1.0;
-    __complex__ double beta        = 0.0;
+    __complex__ double beta        = accumulate ? 1.0 : 0.0;
 
     cblas_zgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -23,6 +23,55 @@ namespace cunumeric {
 
 using namespace Legion;
 
+#define INT8_TILE_DIM 16
+
+// cuBLAS only supports int8 GEMMs with 4-byte aligned leading dimensions and limited transpose
+// combinations, so int8 products use this shared memory kernel, which takes any layout.
+static __global__ void __launch_bounds__((INT8_TILE_DIM * INT8_TILE_DIM), MIN_CTAS_PER_SM)
+  int8_gemm_kernel(size_t m,
+                   size_t n,
+                   size_t k,
+                   int32_t* lhs,
+                   const int8_t* rhs1,
+                   const int8_t* rhs2,
+                   size_t lhs_stride,
+                   size_t rhs1_stride,
+                   size_t rhs2_stride,
+                   bool rhs1_transposed,
+                   bool rhs2_transposed,
+                   bool accumulate)
+{
+  __shared__ int32_t rhs1_tile[INT8_TILE_DIM][INT8_TILE_DIM + 1 /*avoid bank conflicts*/];
+  __shared__ int32_t rhs2_tile[INT8_TILE_DIM][INT8_TILE_DIM + 1];
+
+  const size_t row = blockIdx.y * INT8_TILE_DIM + threadIdx.y;
+  const size_t col = blockIdx.x * INT8_TILE_DIM + threadIdx.x;
+
+  int32_t acc = 0;
+  for (size_t k_lo = 0; k_lo < k; k_lo += INT8_TILE_DIM) {
+    const size_t l1 = k_lo + threadIdx.x;
+    const size_t l2 = k_lo + threadIdx.y;
+    int32_t a       = 0;
+    int32_t b       = 0;
+    if (row < m && l1 < k)
+      a = rhs1_transposed ? rhs1[l1 * rhs1_stride + row] : rhs1[row * rhs1_stride + l1];
+    if (l2 < k && col < n)
+      b = rhs2_transposed ? rhs2[col * rhs2_stride + l2] : rhs2[l2 * rhs2_stride + col];
+    rhs1_tile[threadIdx.y][threadIdx.x] = a;
+    rhs2_tile[threadIdx.y][threadIdx.x] = b;
+    __syncthreads();
+
+#pragma unroll
+    for (int l = 0; l < INT8_TILE_DIM; l++)
+      acc += rhs1_tile[threadIdx.y][l] * rhs2_tile[l][threadIdx.x];
+    __syncthreads();
+  }
+
+  if (row >= m || col >= n) return;
+  int32_t* out = lhs + row * lhs_stride + col;
+  *out         = accumulate ? *out + acc : acc;
+}
+
 // NOTE:
 // cuBLAS doesn't support row-major, so reverse the matrix order so it thinks things are
 // column-major. Effectively we get NxM = NxK * KxM.
@@ -41,14 +90,15 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     auto cublas_handle = get_cublas();
     auto task_stream   = get_cached_stream();
     CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
 
     const float alpha = 1.0;
-    const float beta  = 0.0;
+    const float beta  = accumulate ? 1.0 : 0.0;
 
     CHECK_CUBLAS(cublasSgemmEx(cublas_handle,
                                rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
@@ -84,14 +134,15 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     auto cublas_handle = get_cublas();
     auto task_stream   = get_cached_stream();
     CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
 
     const double alpha = 1.0;
-    const double beta  = 0.0;
+    const double beta  = accumulate ? 1.0 : 0.0;
 
     CHECK_CUBLAS(cublasDgemm(cublas_handle,
                              rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
@@ -124,14 +175,15 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::HALF_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     auto cublas_handle = get_cublas();
     auto task_stream   = get_cached_stream();
     CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
 
     const float alpha = 1.0;
-    const float beta  = 0.0;
+    const float beta  = accumulate ? 1.0 : 0.0;
 
     CHECK_CUBLAS(cublasSgemmEx(cublas_handle,
                                rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
@@ -155,6 +207,43 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::HALF_LT> {
   }
 };
 
+template <>
+struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::INT8_LT> {
+  void operator()(size_t m,
+                  size_t n,
+                  size_t k,
+                  int32_t* lhs,
+                  const int8_t* rhs1,
+                  const int8_t* rhs2,
+                  size_t lhs_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed,
+                  bool accumulate)
+  {
+    auto task_stream = get_cached_stream();
+
+    const dim3 blocks((n + INT8_TILE_DIM - 1) / INT8_TILE_DIM,
+                      (m + INT8_TILE_DIM - 1) / INT8_TILE_DIM);
+    const dim3 threads(INT8_TILE_DIM, INT8_TILE_DIM);
+    int8_gemm_kernel<<<blocks, threads, 0, task_stream>>>(m,
+                                                          n,
+                                                          k,
+                                                          lhs,
+                                                          rhs1,
+                                                          rhs2,
+                                                          lhs_stride,
+                                                          rhs1_stride,
+                                                          rhs2_stride,
+                                                          rhs1_transposed,
+                                                          rhs2_transposed,
+                                                          accumulate);
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
 template <>
 struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
   void operator()(size_t m,
@@ -167,7 +256,8 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cuComplex* lhs        = reinterpret_cast<cuComplex*>(lhs_);
     const cuComplex* rhs1 = reinterpret_cast<const cuComplex*>(rhs1_);
@@ -178,7 +268,7 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
     CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
 
     const cuComplex alpha = make_float2(1.0, 0.0);
-    const cuComplex beta  = make_float2(0.0, 0.0);
+    const cuComplex beta  = make_float2(accumulate ? 1.0 : 0.0, 0.0);
 
     CHECK_CUBLAS(cublasCgemmEx(cublas_handle,
                                rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
@@ -214,7 +304,8 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cuDoubleComplex* lhs        = reinterpret_cast<cuDoubleComplex*>(lhs_);
     const cuDoubleComplex* rhs1 = reinterpret_cast<const cuDoubleComplex*>(rhs1_);
@@ -225,7 +316,7 @@ struct MatMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
     CHECK_CUBLAS(cublasSetStream(cublas_handle, task_stream));
 
     const cuDoubleComplex alpha = make_double2(1.0, 0.0);
-    const cuDoubleComplex beta  = make_double2(0.0, 0.0);
+    const cuDoubleComplex beta  = make_double2(accumulate ? 1.0 : 0.0, 0.0);
 
     CHECK_CUBLAS(cublasZgemm(cublas_handle,
                              rhs2_transposed ? CUBLAS_OP_T : CUBLAS_OP_N,
@@ -24,6 +24,8 @@ struct MatMulArgs {
   const Array& lhs;
   const Array& rhs1;
   const Array& rhs2;
+  // When set, the operands are 2-D tiles and the product is added to the existing values of lhs
+  bool accumulate;
 };
 
 class MatMulTask : public CuNumericTask<MatMulTask> {
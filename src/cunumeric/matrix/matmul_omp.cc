@@ -38,7 +38,8 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::FLOAT_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cblas_sgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -51,7 +52,7 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::FLOAT_LT> {
                 rhs1_stride,
                 rhs2,
                 rhs2_stride,
-                0,
+                accumulate ? 1 : 0,
                 lhs,
                 lhs_stride);
   }
@@ -69,7 +70,8 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::DOUBLE_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     cblas_dgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -82,12 +84,17 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::DOUBLE_LT> {
                 rhs1_stride,
                 rhs2,
                 rhs2_stride,
-                0,
+                accumulate ? 1 : 0,
                 lhs,
                 lhs_stride);
   }
 };
 
+// Extents of the output tiles that stay in cache while the panels along k are multiplied into
+// them, and the number of columns of rhs1 and rows of rhs2 converted to single precision at a time
+#define HALF_GEMM_TILE_SIZE 1024
+#define HALF_GEMM_PANEL_SIZE 256
+
 template <>
 struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::HALF_LT> {
   void operator()(size_t m,
@@ -100,35 +107,87 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::HALF_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
-    auto rhs1_copy = allocate_buffer_omp(m * k);
-    auto rhs2_copy = allocate_buffer_omp(k * n);
+    // The output is computed one tile at a time, and each tile accumulates the products of the
+    // panels along k while it is still in cache. Only the panels of the operands are converted to
+    // float, and each panel is consumed right after its conversion.
+    const size_t tile_m     = std::min<size_t>(m, HALF_GEMM_TILE_SIZE);
+    const size_t tile_n     = std::min<size_t>(n, HALF_GEMM_TILE_SIZE);
+    const size_t panel_size = std::min<size_t>(k, HALF_GEMM_PANEL_SIZE);
+    auto rhs1_copy          = allocate_buffer_omp(tile_m * panel_size);
+    auto rhs2_copy          = allocate_buffer_omp(panel_size * tile_n);
 
-    if (rhs1_transposed)
-      half_matrix_to_float_omp(rhs1_copy, rhs1, k, m, rhs1_stride);
-    else
-      half_matrix_to_float_omp(rhs1_copy, rhs1, m, k, rhs1_stride);
+    for (size_t m_lo = 0; m_lo < m; m_lo += tile_m) {
+      const size_t mb = std::min(tile_m, m - m_lo);
+      for (size_t n_lo = 0; n_lo < n; n_lo += tile_n) {
+        const size_t nb = std::min(tile_n, n - n_lo);
+        for (size_t k_lo = 0; k_lo < k; k_lo += panel_size) {
+          const size_t kb = std::min(panel_size, k - k_lo);
 
-    if (rhs2_transposed)
-      half_matrix_to_float_omp(rhs2_copy, rhs2, n, k, rhs2_stride);
-    else
-      half_matrix_to_float_omp(rhs2_copy, rhs2, k, n, rhs2_stride);
+          if (rhs1_transposed)
+            half_matrix_to_float_omp(
+              rhs1_copy, rhs1 + k_lo * rhs1_stride + m_lo, kb, mb, rhs1_stride);
+          else
+            half_matrix_to_float_omp(
+              rhs1_copy, rhs1 + m_lo * rhs1_stride + k_lo, mb, kb, rhs1_stride);
 
-    cblas_sgemm(CblasRowMajor,
-                rhs1_transposed ? CblasTrans : CblasNoTrans,
-                rhs2_transposed ? CblasTrans : CblasNoTrans,
-                m,
-                n,
-                k,
-                1,
-                rhs1_copy,
-                rhs1_transposed ? m : k,
-                rhs2_copy,
-                rhs2_transposed ? k : n,
-                0,
-                lhs,
-                lhs_stride);
+          if (rhs2_transposed)
+            half_matrix_to_float_omp(
+              rhs2_copy, rhs2 + n_lo * rhs2_stride + k_lo, nb, kb, rhs2_stride);
+          else
+            half_matrix_to_float_omp(
+              rhs2_copy, rhs2 + k_lo * rhs2_stride + n_lo, kb, nb, rhs2_stride);
+
+          cblas_sgemm(CblasRowMajor,
+                      rhs1_transposed ? CblasTrans : CblasNoTrans,
+                      rhs2_transposed ? CblasTrans : CblasNoTrans,
+                      mb,
+                      nb,
+                      kb,
+                      1,
+                      rhs1_copy,
+                      rhs1_transposed ? mb : kb,
+                      rhs2_copy,
+                      rhs2_transposed ? kb : nb,
+                      (accumulate || k_lo > 0) ? 1 : 0,
+                      lhs + m_lo * lhs_stride + n_lo,
+                      lhs_stride);
+        }
+      }
+    }
+  }
+};
+
+template <>
+struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::INT8_LT> {
+  void operator()(size_t m,
+                  size_t n,
+                  size_t k,
+                  int32_t* lhs,
+                  const int8_t* rhs1,
+                  const int8_t* rhs2,
+                  size_t lhs_stride,
+                  size_t rhs1_stride,
+                  size_t rhs2_stride,
+                  bool rhs1_transposed,
+                  bool rhs2_transposed,
+                  bool accumulate)
+  {
+    auto rhs2_copy = widen_int8_matrix_omp(rhs2, k, n, rhs2_stride, rhs2_transposed);
+
+    // Split the rows into one contiguous chunk per thread
+    const size_t num_threads = omp_get_max_threads();
+    const size_t chunk       = (m + num_threads - 1) / num_threads;
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < num_threads; idx++) {
+      const size_t lo = idx * chunk;
+      const size_t hi = std::min(lo + chunk, m);
+      if (lo >= hi) continue;
+      int8_gemm_rows(
+        lo, hi, n, k, lhs, rhs1, rhs2_copy, lhs_stride, rhs1_stride, rhs1_transposed, accumulate);
+    }
   }
 };
 
@@ -144,13 +203,14 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::COMPLEX64_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     __complex__ float* lhs        = reinterpret_cast<__complex__ float*>(lhs_);
     const __complex__ float* rhs1 = reinterpret_cast<const __complex__ float*>(rhs1_);
     const __complex__ float* rhs2 = reinterpret_cast<const __complex__ float*>(rhs2_);
     __complex__ float alpha       = 1.0;
-    __complex__ float beta        = 0.0;
+    __complex__ float beta        = accumulate ? 1.0 : 0.0;
 
     cblas_cgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -181,13 +241,14 @@ struct MatMulImplBody<VariantKind::OMP, LegateTypeCode::COMPLEX128_LT> {
                   size_t rhs1_stride,
                   size_t rhs2_stride,
                   bool rhs1_transposed,
-                  bool rhs2_transposed)
+                  bool rhs2_transposed,
+                  bool accumulate)
   {
     __complex__ double* lhs        = reinterpret_cast<__complex__ double*>(lhs_);
     const __complex__ double* rhs1 = reinterpret_cast<const __complex__ double*>(rhs1_);
     const __complex__ double* rhs2 = reinterpret_cast<const __complex__ double*>(rhs2_);
     __complex__ double alpha       = 1.0;
-    __complex__ double beta        = 0.0;
+    __complex__ double beta        = accumulate ? 1.0 : 0.0;
 
     cblas_zgemm(CblasRowMajor,
                 rhs1_transposed ? CblasTrans : CblasNoTrans,
@@ -44,6 +44,10 @@ struct support_matmul<LegateTypeCode::HALF_LT> : std::true_type {
   using ACC_TYPE = float;
 };
 template <>
+struct support_matmul<LegateTypeCode::INT8_LT> : std::true_type {
+  using ACC_TYPE = int32_t;
+};
+template <>
 struct support_matmul<LegateTypeCode::COMPLEX64_LT> : std::true_type {
   using ACC_TYPE = complex<float>;
 };
@@ -60,6 +64,11 @@ struct MatMulImpl {
     using VAL = legate_type_of<CODE>;
     using ACC = typename support_matmul<CODE>::ACC_TYPE;
 
+    if (args.accumulate) {
+      accumulate<CODE>(args);
+      return;
+    }
+
     // Note that rhs1 and rhs2 may have different shapes. Here's why: rhs1 and rhs2 are promoted
     // on one of their dimensions, and in case that the promoted dimension is partitioned,
     // the store cannot see that partitioning, because that dimension doesn't map to the store's
@@ -103,7 +112,64 @@ struct MatMulImpl {
                                  rhs1_stride,
                                  rhs2_stride,
                                  rhs1_transposed,
-                                 rhs2_transposed);
+                                 rhs2_transposed,
+                                 false);
+  }
+
+  // Multiplies a pair of panels and adds the product to the output tile. This is the local step of
+  // the SUMMA algorithm, where the panels are broadcast to the tasks along each row and column of
+  // the processor grid.
+  template <LegateTypeCode CODE>
+  void accumulate(MatMulArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+    using ACC = typename support_matmul<CODE>::ACC_TYPE;
+
+    auto lhs_shape  = args.lhs.shape<2>();
+    auto rhs1_shape = args.rhs1.shape<2>();
+    auto rhs2_shape = args.rhs2.shape<2>();
+
+    if (lhs_shape.empty() || rhs1_shape.empty()) return;
+
+    const auto m = lhs_shape.hi[0] - lhs_shape.lo[0] + 1;
+    const auto n = lhs_shape.hi[1] - lhs_shape.lo[1] + 1;
+    const auto k = rhs1_shape.hi[1] - rhs1_shape.lo[1] + 1;
+
+#ifdef DEBUG_CUNUMERIC
+    assert(m == rhs1_shape.hi[0] - rhs1_shape.lo[0] + 1);
+    assert(k == rhs2_shape.hi[0] - rhs2_shape.lo[0] + 1);
+    assert(n == rhs2_shape.hi[1] - rhs2_shape.lo[1] + 1);
+#endif
+
+    size_t lhs_strides[2];
+    size_t rhs1_strides[2];
+    size_t rhs2_strides[2];
+
+    auto rhs1 = args.rhs1.read_accessor<VAL, 2>(rhs1_shape).ptr(rhs1_shape, rhs1_strides);
+    auto rhs2 = args.rhs2.read_accessor<VAL, 2>(rhs2_shape).ptr(rhs2_shape, rhs2_strides);
+    auto lhs  = args.lhs.read_write_accessor<ACC, 2>(lhs_shape).ptr(lhs_shape, lhs_strides);
+
+#ifdef DEBUG_CUNUMERIC
+    assert(lhs_strides[1] == 1);
+#endif
+
+    bool rhs1_transposed;
+    bool rhs2_transposed;
+    size_t rhs1_stride = stride_for_blas(m, k, rhs1_strides[0], rhs1_strides[1], rhs1_transposed);
+    size_t rhs2_stride = stride_for_blas(k, n, rhs2_strides[0], rhs2_strides[1], rhs2_transposed);
+
+    MatMulImplBody<KIND, CODE>()(m,
+                                 n,
+                                 k,
+                                 lhs,
+                                 rhs1,
+                                 rhs2,
+                                 lhs_strides[0],
+                                 rhs1_stride,
+                                 rhs2_stride,
+                                 rhs1_transposed,
+                                 rhs2_transposed,
+                                 true);
   }
 
   template <LegateTypeCode CODE, std::enable_if_t<!support_matmul<CODE>::value>* = nullptr>
@@ -119,7 +185,11 @@ static void matmul_template(TaskContext& context)
   auto& reductions = context.reductions();
   auto& inputs     = context.inputs();
 
-  MatMulArgs args{reductions[0], inputs[0], inputs[1]};
+  // The SUMMA driver passes the output tile as a read-write output instead of a reduction
+  const bool accumulate = reductions.empty();
+  auto& lhs             = accumulate ? context.outputs()[0] : reductions[0];
+
+  MatMulArgs args{lhs, inputs[0], inputs[1], accumulate};
   // Note that we can't dispatch on the lhs's type,
   // as the lhs can have a different type than the rhs'
   type_dispatch(args.rhs1.code(), MatMulImpl<KIND>{}, args);
@@ -23,6 +23,30 @@ namespace cunumeric {
 
 using namespace Legion;
 
+// Computes one output element per thread, accumulating in int32
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  int8_gemv_kernel(size_t m,
+                   size_t n,
+                   int32_t* lhs,
+                   const int8_t* mat,
+                   const int8_t* vec,
+                   size_t mat_stride,
+                   bool transpose_mat)
+{
+  const size_t idx = global_tid_1d();
+  if (transpose_mat) {
+    if (idx >= n) return;
+    int32_t acc = 0;
+    for (size_t i = 0; i < m; i++) acc += int32_t(mat[i * mat_stride + idx]) * vec[i];
+    lhs[idx] = acc;
+  } else {
+    if (idx >= m) return;
+    int32_t acc = 0;
+    for (size_t j = 0; j < n; j++) acc += int32_t(mat[idx * mat_stride + j]) * vec[j];
+    lhs[idx] = acc;
+  }
+}
+
 template <>
 struct MatVecMulImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
   void operator()(size_t m,
@@ -161,6 +185,27 @@ struct MatVecMulImplBody<VariantKind::GPU, LegateTypeCode::HALF_LT> {
   }
 };
 
+template <>
+struct MatVecMulImplBody<VariantKind::GPU, LegateTypeCode::INT8_LT> {
+  void operator()(size_t m,
+                  size_t n,
+                  int32_t* lhs,
+                  const int8_t* mat,
+                  const int8_t* vec,
+                  size_t mat_stride,
+                  bool transpose_mat)
+  {
+    auto task_stream = get_cached_stream();
+
+    const size_t volume = transpose_mat ? n : m;
+    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    int8_gemv_kernel<<<blocks, THREADS_PER_BLOCK, 0, task_stream>>>(
+      m, n, lhs, mat, vec, mat_stride, transpose_mat);
+
+    CHECK_CUDA_STREAM(task_stream);
+  }
+};
+
 template <>
 struct MatVecMulImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
   void operator()(size_t m,
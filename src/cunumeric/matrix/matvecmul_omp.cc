@@ -79,6 +79,20 @@ struct MatVecMulImplBody<VariantKind::OMP, LegateTypeCode::HALF_LT> {
   }
 };
 
+template <>
+struct MatVecMulImplBody<VariantKind::OMP, LegateTypeCode::INT8_LT> {
+  void operator()(size_t m,
+                  size_t n,
+                  int32_t* lhs,
+                  const int8_t* mat,
+                  const int8_t* vec,
+                  size_t mat_stride,
+                  bool transpose_mat)
+  {
+    int8_gemv_omp(m, n, lhs, mat, vec, mat_stride, transpose_mat);
+  }
+};
+
 template <>
 struct MatVecMulImplBody<VariantKind::OMP, LegateTypeCode::COMPLEX64_LT> {
   void operator()(size_t m,
@@ -44,6 +44,10 @@ struct support_matvecmul<LegateTypeCode::HALF_LT> : std::true_type {
   using ACC_TYPE = float;
 };
 template <>
+struct support_matvecmul<LegateTypeCode::INT8_LT> : std::true_type {
+  using ACC_TYPE = int32_t;
+};
+template <>
 struct support_matvecmul<LegateTypeCode::COMPLEX64_LT> : std::true_type {
   using ACC_TYPE = complex<float>;
 };
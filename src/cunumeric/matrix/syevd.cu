@@ -0,0 +1,114 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/syevd.h"
+#include "cunumeric/matrix/syevd_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename SyevdBufferSize, typename Syevd, typename VAL, typename RVAL>
+static inline void syevd_template(SyevdBufferSize syevdBufferSize,
+                                  Syevd syevd,
+                                  const VAL* a,
+                                  RVAL* w,
+                                  VAL* v,
+                                  int32_t n,
+                                  bool lower)
+{
+  auto context = get_cusolver();
+  auto stream  = get_cached_stream();
+  CHECK_CUSOLVER(cusolverDnSetStream(context, stream));
+
+  auto jobz = v != nullptr ? CUSOLVER_EIG_MODE_VECTOR : CUSOLVER_EIG_MODE_NOVECTOR;
+  auto uplo = lower ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER;
+
+  auto buffer = create_buffer<VAL>(v != nullptr ? 1 : static_cast<size_t>(n) * n,
+                                   Memory::Kind::GPU_FB_MEM);
+  auto info   = create_buffer<int32_t>(1, Memory::Kind::Z_COPY_MEM);
+
+  // The eigenvectors overwrite the input, which must be preserved
+  auto vec = v != nullptr ? v : buffer.ptr(0);
+  CHECK_CUDA(cudaMemcpyAsync(vec, a, sizeof(VAL) * n * n, cudaMemcpyDeviceToDevice, stream));
+
+  int32_t bufferSize;
+  CHECK_CUSOLVER(syevdBufferSize(context, jobz, uplo, n, vec, n, w, &bufferSize));
+
+  auto work = create_buffer<VAL>(bufferSize, Memory::Kind::GPU_FB_MEM);
+
+  CHECK_CUSOLVER(syevd(context, jobz, uplo, n, vec, n, w, work.ptr(0), bufferSize, info.ptr(0)));
+
+  // TODO: We need a deferred exception to avoid this synchronization
+  CHECK_CUDA(cudaStreamSynchronize(stream));
+  CHECK_CUDA_STREAM(stream);
+
+  if (info[0] != 0) throw legate::TaskException("Eigenvalues did not converge");
+}
+
+template <>
+struct SyevdImplBody<VariantKind::GPU, LegateTypeCode::FLOAT_LT> {
+  void operator()(const float* a, float* w, float* v, int32_t n, bool lower)
+  {
+    syevd_template(cusolverDnSsyevd_bufferSize, cusolverDnSsyevd, a, w, v, n, lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::GPU, LegateTypeCode::DOUBLE_LT> {
+  void operator()(const double* a, double* w, double* v, int32_t n, bool lower)
+  {
+    syevd_template(cusolverDnDsyevd_bufferSize, cusolverDnDsyevd, a, w, v, n, lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a, float* w, complex<float>* v, int32_t n, bool lower)
+  {
+    syevd_template(cusolverDnCheevd_bufferSize,
+                   cusolverDnCheevd,
+                   reinterpret_cast<const cuComplex*>(a),
+                   w,
+                   reinterpret_cast<cuComplex*>(v),
+                   n,
+                   lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::GPU, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a, double* w, complex<double>* v, int32_t n, bool lower)
+  {
+    syevd_template(cusolverDnZheevd_bufferSize,
+                   cusolverDnZheevd,
+                   reinterpret_cast<const cuDoubleComplex*>(a),
+                   w,
+                   reinterpret_cast<cuDoubleComplex*>(v),
+                   n,
+                   lower);
+  }
+};
+
+/*static*/ void SyevdTask::gpu_variant(TaskContext& context)
+{
+  syevd_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,136 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/matrix/syevd.h"
+#include "cunumeric/matrix/syevd_template.inl"
+
+#include <cblas.h>
+#include <lapack.h>
+#include <cstring>
+#include <omp.h>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename Syevd, typename VAL>
+static inline void syevd_template(
+  Syevd syevd, const VAL* a, VAL* w, VAL* v, int32_t n, bool lower)
+{
+  char jobz      = v != nullptr ? 'V' : 'N';
+  char uplo      = lower ? 'L' : 'U';
+  int32_t lwork  = v != nullptr ? 1 + 6 * n + 2 * n * n : 2 * n + 1;
+  int32_t liwork = v != nullptr ? 3 + 5 * n : 1;
+  int32_t info   = 0;
+
+  auto buffer = create_buffer<VAL>(v != nullptr ? 1 : static_cast<size_t>(n) * n);
+  auto work   = create_buffer<VAL>(lwork);
+  auto iwork  = create_buffer<int32_t>(liwork);
+
+  // The eigenvectors overwrite the input, which must be preserved
+  auto vec = v != nullptr ? v : buffer.ptr(0);
+  std::memcpy(vec, a, sizeof(VAL) * n * n);
+
+  syevd(&jobz, &uplo, &n, vec, &n, w, work.ptr(0), &lwork, iwork.ptr(0), &liwork, &info);
+  if (info != 0) throw legate::TaskException("Eigenvalues did not converge");
+}
+
+template <typename Heevd, typename VAL, typename RVAL>
+static inline void heevd_template(
+  Heevd heevd, const VAL* a, RVAL* w, VAL* v, int32_t n, bool lower)
+{
+  char jobz      = v != nullptr ? 'V' : 'N';
+  char uplo      = lower ? 'L' : 'U';
+  int32_t lwork  = v != nullptr ? 2 * n + n * n : n + 1;
+  int32_t lrwork = v != nullptr ? 1 + 5 * n + 2 * n * n : n;
+  int32_t liwork = v != nullptr ? 3 + 5 * n : 1;
+  int32_t info   = 0;
+
+  auto buffer = create_buffer<VAL>(v != nullptr ? 1 : static_cast<size_t>(n) * n);
+  auto work   = create_buffer<VAL>(lwork);
+  auto rwork  = create_buffer<RVAL>(lrwork);
+  auto iwork  = create_buffer<int32_t>(liwork);
+
+  // The eigenvectors overwrite the input, which must be preserved
+  auto vec = v != nullptr ? v : buffer.ptr(0);
+  std::memcpy(vec, a, sizeof(VAL) * n * n);
+
+  heevd(&jobz,
+        &uplo,
+        &n,
+        vec,
+        &n,
+        w,
+        work.ptr(0),
+        &lwork,
+        rwork.ptr(0),
+        &lrwork,
+        iwork.ptr(0),
+        &liwork,
+        &info);
+  if (info != 0) throw legate::TaskException("Eigenvalues did not converge");
+}
+
+template <>
+struct SyevdImplBody<VariantKind::OMP, LegateTypeCode::FLOAT_LT> {
+  void operator()(const float* a, float* w, float* v, int32_t n, bool lower)
+  {
+    syevd_template(ssyevd_, a, w, v, n, lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::OMP, LegateTypeCode::DOUBLE_LT> {
+  void operator()(const double* a, double* w, double* v, int32_t n, bool lower)
+  {
+    syevd_template(dsyevd_, a, w, v, n, lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::OMP, LegateTypeCode::COMPLEX64_LT> {
+  void operator()(const complex<float>* a, float* w, complex<float>* v, int32_t n, bool lower)
+  {
+    heevd_template(cheevd_,
+                   reinterpret_cast<const __complex__ float*>(a),
+                   w,
+                   reinterpret_cast<__complex__ float*>(v),
+                   n,
+                   lower);
+  }
+};
+
+template <>
+struct SyevdImplBody<VariantKind::OMP, LegateTypeCode::COMPLEX128_LT> {
+  void operator()(const complex<double>* a, double* w, complex<double>* v, int32_t n, bool lower)
+  {
+    heevd_template(zheevd_,
+                   reinterpret_cast<const __complex__ double*>(a),
+                   w,
+                   reinterpret_cast<__complex__ double*>(v),
+                   n,
+                   lower);
+  }
+};
+
+/*static*/ void SyevdTask::omp_variant(TaskContext& context)
+{
+  openblas_set_num_threads(omp_get_max_threads());
+  syevd_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,103 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/matrix/syevd.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <VariantKind KIND, LegateTypeCode CODE>
+struct SyevdImplBody;
+
+template <LegateTypeCode CODE>
+struct support_syevd : std::false_type {
+};
+template <>
+struct support_syevd<LegateTypeCode::DOUBLE_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::DOUBLE_LT;
+};
+template <>
+struct support_syevd<LegateTypeCode::FLOAT_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::FLOAT_LT;
+};
+template <>
+struct support_syevd<LegateTypeCode::COMPLEX64_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::FLOAT_LT;
+};
+template <>
+struct support_syevd<LegateTypeCode::COMPLEX128_LT> : std::true_type {
+  static constexpr LegateTypeCode REAL_CODE = LegateTypeCode::DOUBLE_LT;
+};
+
+template <VariantKind KIND>
+struct SyevdImpl {
+  template <LegateTypeCode CODE, std::enable_if_t<support_syevd<CODE>::value>* = nullptr>
+  void operator()(Array& a_array, Array& w_array, Array* v_array, bool lower) const
+  {
+    using VAL  = legate_type_of<CODE>;
+    using RVAL = legate_type_of<support_syevd<CODE>::REAL_CODE>;
+
+    auto a_shape = a_array.shape<2>();
+
+    if (a_shape.empty()) return;
+
+    size_t a_strides[2];
+
+    auto w_shape = w_array.shape<1>();
+    auto a       = a_array.read_accessor<VAL, 2>(a_shape).ptr(a_shape, a_strides);
+    auto w       = w_array.write_accessor<RVAL, 1>(w_shape).ptr(w_shape);
+    auto n       = static_cast<int32_t>(a_shape.hi[0] - a_shape.lo[0] + 1);
+    assert(a_shape.hi[1] - a_shape.lo[1] + 1 == n);
+    assert(w_shape.volume() == n);
+
+    VAL* v = nullptr;
+    if (v_array != nullptr) {
+      size_t v_strides[2];
+      auto v_shape = v_array->shape<2>();
+      v            = v_array->write_accessor<VAL, 2>(v_shape).ptr(v_shape, v_strides);
+      assert(v_shape.volume() == static_cast<size_t>(n) * n);
+    }
+
+    SyevdImplBody<KIND, CODE>()(a, w, v, n, lower);
+  }
+
+  template <LegateTypeCode CODE, std::enable_if_t<!support_syevd<CODE>::value>* = nullptr>
+  void operator()(Array& a_array, Array& w_array, Array* v_array, bool lower) const
+  {
+    assert(false);
+  }
+};
+
+// Computes the eigenvalues in ascending order and, when a second output is passed, the
+// eigenvectors of a symmetric (Hermitian, if complex) matrix. Only the triangle selected by
+// the scalar argument is referenced.
+template <VariantKind KIND>
+static void syevd_template(TaskContext& context)
+{
+  auto& outputs = context.outputs();
+  auto& a       = context.inputs()[0];
+  auto& w       = outputs[0];
+  auto* v       = outputs.size() > 1 ? &outputs[1] : nullptr;
+  auto lower    = context.scalars()[0].value<bool>();
+  type_dispatch(a.code(), SyevdImpl<KIND>{}, a, w, v, lower);
+}
+
+}  // namespace cunumeric
@@ -121,4 +121,76 @@ void float_tensor_to_half(
   }
 }
 
+int16_t* widen_int8_matrix(const int8_t* in, size_t m, size_t n, size_t pitch, bool transposed)
+{
+  auto buffer = legate::create_buffer<int16_t, 1>(m * n, Memory::Kind::SYSTEM_MEM);
+  auto out    = buffer.ptr(0);
+  if (transposed)
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) out[i * n + j] = in[j * pitch + i];
+  else
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) out[i * n + j] = in[i * pitch + j];
+  return out;
+}
+
+// A block of the widened rhs2 is 256x512x2 bytes, which stays in L2 while it is applied to all rows
+#define INT8_GEMM_BLOCK_K 256
+#define INT8_GEMM_BLOCK_N 512
+
+void int8_gemm_rows(size_t row_lo,
+                    size_t row_hi,
+                    size_t n,
+                    size_t k,
+                    int32_t* lhs,
+                    const int8_t* rhs1,
+                    const int16_t* rhs2,
+                    size_t lhs_stride,
+                    size_t rhs1_stride,
+                    bool rhs1_transposed,
+                    bool accumulate)
+{
+  if (!accumulate)
+    for (size_t i = row_lo; i < row_hi; i++)
+      for (size_t j = 0; j < n; j++) lhs[i * lhs_stride + j] = 0;
+
+  for (size_t j_lo = 0; j_lo < n; j_lo += INT8_GEMM_BLOCK_N) {
+    const size_t j_hi = std::min<size_t>(j_lo + INT8_GEMM_BLOCK_N, n);
+    for (size_t k_lo = 0; k_lo < k; k_lo += INT8_GEMM_BLOCK_K) {
+      const size_t k_hi = std::min<size_t>(k_lo + INT8_GEMM_BLOCK_K, k);
+      for (size_t i = row_lo; i < row_hi; i++) {
+        int32_t* out = lhs + i * lhs_stride;
+        for (size_t l = k_lo; l < k_hi; l++) {
+          const int32_t a = rhs1_transposed ? rhs1[l * rhs1_stride + i] : rhs1[i * rhs1_stride + l];
+          if (a == 0) continue;
+          const int16_t* b = rhs2 + l * n;
+          for (size_t j = j_lo; j < j_hi; j++) out[j] += a * b[j];
+        }
+      }
+    }
+  }
+}
+
+void int8_gemv(size_t m,
+               size_t n,
+               int32_t* lhs,
+               const int8_t* mat,
+               const int8_t* vec,
+               size_t mat_stride,
+               bool transpose_mat)
+{
+  if (transpose_mat) {
+    for (size_t j = 0; j < n; j++) lhs[j] = 0;
+    for (size_t i = 0; i < m; i++) {
+      const int32_t a = vec[i];
+      for (size_t j = 0; j < n; j++) lhs[j] += a * mat[i * mat_stride + j];
+    }
+  } else
+    for (size_t i = 0; i < m; i++) {
+      int32_t acc = 0;
+      for (size_t j = 0; j < n; j++) acc += int32_t(mat[i * mat_stride + j]) * vec[j];
+      lhs[i] = acc;
+    }
+}
+
 }  // namespace cunumeric
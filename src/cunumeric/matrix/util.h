@@ -57,4 +57,34 @@ void half_tensor_to_float(
 void float_tensor_to_half(
   __half* out, const float* in, size_t ndim, const int64_t* shape, const int64_t* out_strides);
 
+// BLAS libraries have no integer GEMM, so int8 products are computed by the following kernels,
+// which widen the operands and accumulate in int32. The loops are blocked for the cache and written
+// so that the compiler can vectorize the innermost one.
+
+// Copies an int8 matrix to a row-major int16 matrix. If transposed is set, the input is the
+// transpose of a row-major nxm matrix.
+int16_t* widen_int8_matrix(const int8_t* in, size_t m, size_t n, size_t pitch, bool transposed);
+
+// Computes rows [row_lo, row_hi) of lhs = rhs1 @ rhs2, where rhs2 has been widened to a row-major
+// kxn matrix. If accumulate is set, the product is added to the existing values of lhs.
+void int8_gemm_rows(size_t row_lo,
+                    size_t row_hi,
+                    size_t n,
+                    size_t k,
+                    int32_t* lhs,
+                    const int8_t* rhs1,
+                    const int16_t* rhs2,
+                    size_t lhs_stride,
+                    size_t rhs1_stride,
+                    bool rhs1_transposed,
+                    bool accumulate);
+
+void int8_gemv(size_t m,
+               size_t n,
+               int32_t* lhs,
+               const int8_t* mat,
+               const int8_t* vec,
+               size_t mat_stride,
+               bool transpose_mat);
+
 }  // namespace cunumeric
@@ -19,6 +19,13 @@
 #include "cunumeric/cunumeric.h"
 #include "cunumeric/matrix/util.h"
 #include "cunumeric/matrix/util_omp.h"
+#include "cunumeric/omp_help.h"
+
+// F16C is picked at runtime, so that builds for a generic x86-64 target still use it
+#if defined(__x86_64__) && defined(__GNUC__)
+#define CUNUMERIC_F16C_DISPATCH
+#include <immintrin.h>
+#endif
 
 namespace cunumeric {
 
@@ -26,23 +33,61 @@ using namespace Legion;
 
 float* allocate_buffer_omp(size_t size)
 {
-  Memory::Kind kind = CuNumeric::has_numamem ? Memory::Kind::SOCKET_MEM : Memory::Kind::SYSTEM_MEM;
   // We will not call this function on GPUs
-  auto buffer = legate::create_buffer<float, 1>(size, kind);
+  auto buffer = create_scratch_buffer_omp<float>(size);
   return buffer.ptr(0);
 }
 
+#ifdef CUNUMERIC_F16C_DISPATCH
+static bool cpu_has_f16c()
+{
+  static const bool has_f16c = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+  }();
+  return has_f16c;
+}
+
+// Converts eight values per instruction. This is compiled for F16C regardless of the build's
+// target and must only be called when cpu_has_f16c() holds.
+__attribute__((target("avx,f16c"))) static void half_row_to_float_f16c(float* out,
+                                                                        const __half* in,
+                                                                        size_t n)
+{
+  static_assert(sizeof(__half) == sizeof(uint16_t), "__half must be a 16-bit value");
+  size_t j = 0;
+  for (; j + 8 <= n; j += 8) {
+    auto halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + j));
+    _mm256_storeu_ps(out + j, _mm256_cvtph_ps(halves));
+  }
+  for (; j < n; j++) out[j] = in[j];
+}
+#endif
+
+// Converts a contiguous run of half-precision values
+static inline void half_row_to_float(float* out, const __half* in, size_t n)
+{
+#ifdef CUNUMERIC_F16C_DISPATCH
+  if (cpu_has_f16c()) {
+    half_row_to_float_f16c(out, in, n);
+    return;
+  }
+#endif
+  for (size_t j = 0; j < n; j++) out[j] = in[j];
+}
+
 void half_vector_to_float_omp(float* out, const __half* ptr, size_t n)
 {
+  const size_t chunk = 4096;
 #pragma omp parallel for schedule(static)
-  for (size_t idx = 0; idx < n; idx++) out[idx] = ptr[idx];
+  for (size_t lo = 0; lo < n; lo += chunk)
+    half_row_to_float(out + lo, ptr + lo, std::min(chunk, n - lo));
 }
 
 void half_matrix_to_float_omp(float* out, const __half* ptr, size_t m, size_t n, size_t pitch)
 {
 #pragma omp parallel for schedule(static)
-  for (size_t i = 0; i < m; i++)
-    for (size_t j = 0; j < n; j++) out[i * n + j] = ptr[i * pitch + j];
+  for (size_t i = 0; i < m; i++) half_row_to_float(out + i * n, ptr + i * pitch, n);
 }
 
 void half_tensor_to_float_omp(
@@ -56,6 +101,17 @@ void half_tensor_to_float_omp(
   }
 }
 
+void add_float_tensor_to_half_omp(
+  __half* out, const float* in, size_t ndim, const int64_t* shape, const int64_t* out_strides)
+{
+  int64_t volume = calculate_volume(ndim, shape);
+#pragma omp parallel for schedule(static)
+  for (int64_t in_idx = 0; in_idx < volume; ++in_idx) {
+    int64_t out_idx = unflatten_with_strides(in_idx, ndim, shape, out_strides);
+    out[out_idx]    = static_cast<float>(out[out_idx]) + in[in_idx];
+  }
+}
+
 void float_tensor_to_half_omp(
   __half* out, const float* in, size_t ndim, const int64_t* shape, const int64_t* out_strides)
 {
@@ -67,4 +123,47 @@ void float_tensor_to_half_omp(
   }
 }
 
+int16_t* widen_int8_matrix_omp(const int8_t* in, size_t m, size_t n, size_t pitch, bool transposed)
+{
+  // The copies below touch the buffer first, with the same schedule as the consumers
+  auto buffer = legate::create_buffer<int16_t, 1>(m * n, scratch_memory_kind_omp());
+  auto out    = buffer.ptr(0);
+  if (transposed) {
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) out[i * n + j] = in[j * pitch + i];
+  } else {
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) out[i * n + j] = in[i * pitch + j];
+  }
+  return out;
+}
+
+void int8_gemv_omp(size_t m,
+                   size_t n,
+                   int32_t* lhs,
+                   const int8_t* mat,
+                   const int8_t* vec,
+                   size_t mat_stride,
+                   bool transpose_mat)
+{
+  if (transpose_mat) {
+    // Each thread owns a range of the outputs and walks down all rows of the matrix
+#pragma omp parallel for schedule(static)
+    for (size_t j = 0; j < n; j++) {
+      int32_t acc = 0;
+      for (size_t i = 0; i < m; i++) acc += int32_t(mat[i * mat_stride + j]) * vec[i];
+      lhs[j] = acc;
+    }
+  } else {
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < m; i++) {
+      int32_t acc = 0;
+      for (size_t j = 0; j < n; j++) acc += int32_t(mat[i * mat_stride + j]) * vec[j];
+      lhs[i] = acc;
+    }
+  }
+}
+
 }  // namespace cunumeric
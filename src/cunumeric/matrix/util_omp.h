@@ -34,4 +34,18 @@ void half_tensor_to_float_omp(
 void float_tensor_to_half_omp(
   __half* out, const float* in, size_t ndim, const int64_t* shape, const int64_t* out_strides);
 
+// Adds the float tensor to the half-precision tensor in place
+void add_float_tensor_to_half_omp(
+  __half* out, const float* in, size_t ndim, const int64_t* shape, const int64_t* out_strides);
+
+int16_t* widen_int8_matrix_omp(const int8_t* in, size_t m, size_t n, size_t pitch, bool transposed);
+
+void int8_gemv_omp(size_t m,
+                   size_t n,
+                   int32_t* lhs,
+                   const int8_t* mat,
+                   const int8_t* vec,
+                   size_t mat_stride,
+                   bool transpose_mat);
+
 }  // namespace cunumeric
@@ -18,6 +18,9 @@
 
 #include <vector>
 
+#include "legion.h"
+#include "core/data/buffer.h"
+
 namespace cunumeric {
 
 // Simple STL vector-based thread local storage for OpenMP threads to avoid false sharing
@@ -47,4 +50,41 @@ struct ThreadLocalStorage {
   size_t num_threads_;
 };
 
+// Returns the kind of memory for scratch buffers of OpenMP tasks. OpenMP processors are created
+// per socket, so the socket memory with affinity to the executing processor is local to all of its
+// threads. Nodes are checked one processor at a time, as they can differ in their memories.
+inline Legion::Memory::Kind scratch_memory_kind_omp()
+{
+  // A thread always executes tasks for the same processor, so cache the answer
+  static thread_local Legion::Processor cached_proc    = Legion::Processor::NO_PROC;
+  static thread_local Legion::Memory::Kind cached_kind = Legion::Memory::Kind::SYSTEM_MEM;
+
+  auto proc = Legion::Processor::get_executing_processor();
+  if (proc != cached_proc) {
+    Legion::Machine::MemoryQuery query(Legion::Machine::get_machine());
+    query.only_kind(Legion::Memory::Kind::SOCKET_MEM).has_affinity_to(proc);
+    cached_kind = query.count() > 0 ? Legion::Memory::Kind::SOCKET_MEM
+                                    : Legion::Memory::Kind::SYSTEM_MEM;
+    cached_proc = proc;
+  }
+  return cached_kind;
+}
+
+// Creates a scratch buffer for an OpenMP task. Socket memory is bound to its NUMA node already,
+// but pages of system memory are placed by the first thread that writes them. Those are touched
+// here with a static schedule, which puts them next to the threads of any loop over the buffer
+// that uses a static schedule too.
+template <typename VAL>
+legate::Buffer<VAL> create_scratch_buffer_omp(size_t size)
+{
+  auto kind   = scratch_memory_kind_omp();
+  auto buffer = legate::create_buffer<VAL>(size, kind);
+  if (kind == Legion::Memory::Kind::SYSTEM_MEM) {
+    auto ptr = buffer.ptr(0);
+#pragma omp parallel for schedule(static)
+    for (size_t idx = 0; idx < size; ++idx) ptr[idx] = VAL{};
+  }
+  return buffer;
+}
+
 }  // namespace cunumeric
@@ -115,4 +115,16 @@ class Pitches<0, C_ORDER> {
   }
 };
 
+// Returns the number of consecutive elements of `rect` in row-major order whose linear offsets
+// in a global array with the given strides are also consecutive
+template <int DIM>
+inline size_t contiguous_extent(const Legion::Rect<DIM>& rect, const Legion::Point<DIM>& strides)
+{
+  if (strides[DIM - 1] != 1) return 1;
+  size_t extent = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  for (int dim = DIM - 2; dim >= 0 && extent == static_cast<size_t>(strides[dim]); --dim)
+    extent *= rect.hi[dim] - rect.lo[dim] + 1;
+  return extent;
+}
+
 }  // namespace cunumeric
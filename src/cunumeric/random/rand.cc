@@ -25,17 +25,30 @@ using namespace legate;
 template <typename RNG, typename VAL, int32_t DIM>
 struct RandImplBody<VariantKind::CPU, RNG, VAL, DIM> {
   void operator()(AccessorWO<VAL, DIM> out,
+                  const RandomState& state,
                   const RNG& rng,
                   const Point<DIM>& strides,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool dense) const
   {
     size_t volume = rect.volume();
-    for (size_t idx = 0; idx < volume; ++idx) {
-      const auto point = pitches.unflatten(idx, rect.lo);
-      size_t offset    = 0;
-      for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
-      out[point] = rng(HI_BITS(offset), LO_BITS(offset));
+    if (dense) {
+      auto outptr      = out.ptr(rect);
+      const size_t run = contiguous_extent(rect, strides);
+      for (size_t idx = 0; idx < volume; idx += run) {
+        const auto point = pitches.unflatten(idx, rect.lo);
+        size_t offset    = 0;
+        for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+        generate_range(state, rng, offset, run, outptr + idx);
+      }
+    } else {
+      for (size_t idx = 0; idx < volume; ++idx) {
+        const auto point = pitches.unflatten(idx, rect.lo);
+        size_t offset    = 0;
+        for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+        out[point] = generate(state, rng, offset);
+      }
     }
   }
 };
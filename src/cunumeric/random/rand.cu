@@ -23,31 +23,74 @@ namespace cunumeric {
 
 using namespace Legion;
 
+template <typename Rng>
+constexpr size_t elements_per_thread = Rng::WORDS == 0 ? 1 : 4 / Rng::WORDS;
+
 template <typename WriteAcc, typename Rng, int32_t DIM>
-static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM) rand_kernel(
-  size_t volume, WriteAcc out, Rng rng, Point<DIM> strides, Pitches<DIM - 1> pitches, Point<DIM> lo)
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  rand_kernel(size_t volume,
+              WriteAcc out,
+              RandomState state,
+              Rng rng,
+              Point<DIM> strides,
+              Pitches<DIM - 1> pitches,
+              Point<DIM> lo)
 {
-  const size_t idx = global_tid_1d();
-  if (idx >= volume) return;
-  auto point    = pitches.unflatten(idx, lo);
-  size_t offset = 0;
-  for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
-  out[point] = rng(HI_BITS(offset), LO_BITS(offset));
+  constexpr size_t COUNT = elements_per_thread<Rng>;
+  const size_t start     = global_tid_1d() * COUNT;
+  if (start >= volume) return;
+  if constexpr (Rng::WORDS == 0) {
+    auto point      = pitches.unflatten(start, lo);
+    uint64_t offset = 0;
+    for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+    out[point] = generate(state, rng, offset);
+  } else {
+    // Each thread generates the elements of one evaluation when they are consecutive
+    uint64_t ctr = UINT64_MAX;
+    uint32_t words[4];
+    // Paired generators produce the values of two lanes at once
+    uint64_t pair = UINT64_MAX;
+    typename Rng::VAL values[2];
+    for (size_t idx = start; idx < start + COUNT && idx < volume; ++idx) {
+      auto point      = pitches.unflatten(idx, lo);
+      uint64_t offset = 0;
+      for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+      if (offset / COUNT != ctr) {
+        ctr = offset / COUNT;
+        RandomEngine::rand_raw(state.key0, state.key1, state.counter + ctr, 0, words);
+      }
+      const uint32_t lane = offset % COUNT;
+      if constexpr (is_paired_generator<Rng>::value) {
+        if (offset / 2 != pair) {
+          pair = offset / 2;
+          rng(lane_bits<Rng::WORDS>(words, lane & ~1U),
+              lane_bits<Rng::WORDS>(words, lane | 1U),
+              values[0],
+              values[1]);
+        }
+        out[point] = values[lane & 1U];
+      } else
+        out[point] = rng(lane_bits<Rng::WORDS>(words, lane));
+    }
+  }
 }
 
 template <typename RNG, typename VAL, int32_t DIM>
 struct RandImplBody<VariantKind::GPU, RNG, VAL, DIM> {
   void operator()(AccessorWO<VAL, DIM> out,
+                  const RandomState& state,
                   const RNG& rng,
                   const Point<DIM>& strides,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool dense) const
   {
-    size_t volume       = rect.volume();
-    const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
-    auto stream         = get_cached_stream();
+    constexpr size_t COUNT = elements_per_thread<RNG>;
+    size_t volume          = rect.volume();
+    const size_t blocks    = (volume + COUNT * THREADS_PER_BLOCK - 1) / (COUNT * THREADS_PER_BLOCK);
+    auto stream            = get_cached_stream();
     rand_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
-      volume, out, rng, strides, pitches, rect.lo);
+      volume, out, state, rng, strides, pitches, rect.lo);
     CHECK_CUDA_STREAM(stream);
   }
 };
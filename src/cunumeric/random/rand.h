@@ -24,7 +24,7 @@ namespace cunumeric {
 struct RandArgs {
   const Array& out;
   RandGenCode gen_code;
-  uint32_t epoch;
+  RandomState state;
   Legion::DomainPoint strides;
   std::vector<legate::Store> args;
 };
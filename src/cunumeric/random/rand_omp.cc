@@ -25,20 +25,45 @@ using namespace legate;
 template <typename RNG, typename VAL, int32_t DIM>
 struct RandImplBody<VariantKind::OMP, RNG, VAL, DIM> {
   void operator()(AccessorWO<VAL, DIM> out,
+                  const RandomState& state,
                   const RNG& rng,
                   const Point<DIM>& strides,
                   const Pitches<DIM - 1>& pitches,
-                  const Rect<DIM>& rect) const
+                  const Rect<DIM>& rect,
+                  bool dense) const
   {
     size_t volume = rect.volume();
+    if (dense) {
+      auto outptr = out.ptr(rect);
+      // Split the contiguous runs into chunks, so that a single run still keeps all the
+      // threads busy
+      const size_t run            = contiguous_extent(rect, strides);
+      const size_t chunk          = std::min(run, CHUNK_SIZE);
+      const size_t chunks_per_run = (run + chunk - 1) / chunk;
+      const size_t num_chunks     = volume / run * chunks_per_run;
 #pragma omp parallel for schedule(static)
-    for (size_t idx = 0; idx < volume; ++idx) {
-      const auto point = pitches.unflatten(idx, rect.lo);
-      size_t offset    = 0;
-      for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
-      out[point] = rng(HI_BITS(offset), LO_BITS(offset));
+      for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        const size_t run_lo = chunk_idx / chunks_per_run * run;
+        const size_t lo     = run_lo + chunk_idx % chunks_per_run * chunk;
+        const size_t count  = std::min(chunk, run_lo + run - lo);
+        const auto point    = pitches.unflatten(lo, rect.lo);
+        size_t offset       = 0;
+        for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+        generate_range(state, rng, offset, count, outptr + lo);
+      }
+    } else {
+#pragma omp parallel for schedule(static)
+      for (size_t idx = 0; idx < volume; ++idx) {
+        const auto point = pitches.unflatten(idx, rect.lo);
+        size_t offset    = 0;
+        for (size_t dim = 0; dim < DIM; ++dim) offset += point[dim] * strides[dim];
+        out[point] = generate(state, rng, offset);
+      }
     }
   }
+
+  // A multiple of the values a batch of evaluations produces, so that chunks stay aligned
+  static constexpr size_t CHUNK_SIZE = 16384;
 };
 
 /*static*/ void RandTask::omp_variant(TaskContext& context)
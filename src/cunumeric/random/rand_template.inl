@@ -50,8 +50,16 @@ struct RandImpl {
     auto out = args.out.write_accessor<VAL, DIM>(rect);
     Point<DIM> strides(args.strides);
 
-    RNG rng(args.epoch, args.args);
-    RandImplBody<KIND, RNG, VAL, DIM>{}(out, rng, strides, pitches, rect);
+#ifndef LEGION_BOUNDS_CHECKS
+    // Check to see if this is dense or not
+    bool dense = out.accessor.is_dense_row_major(rect);
+#else
+    // No dense execution if we're doing bounds checks
+    bool dense = false;
+#endif
+
+    RNG rng(args.args);
+    RandImplBody<KIND, RNG, VAL, DIM>{}(out, args.state, rng, strides, pitches, rect, dense);
   }
 
   template <LegateTypeCode CODE,
@@ -80,13 +88,14 @@ static void rand_template(TaskContext& context)
   auto& scalars = context.scalars();
 
   auto gen_code = scalars[0].value<RandGenCode>();
-  auto epoch    = scalars[1].value<uint32_t>();
-  auto strides  = scalars[2].value<DomainPoint>();
+  RandomState state{
+    scalars[1].value<uint32_t>(), scalars[2].value<uint32_t>(), scalars[3].value<uint64_t>()};
+  auto strides = scalars[4].value<DomainPoint>();
 
   std::vector<Store> extra_args;
   for (auto& input : inputs) extra_args.push_back(std::move(input));
 
-  RandArgs args{outputs[0], gen_code, epoch, strides, std::move(extra_args)};
+  RandArgs args{outputs[0], gen_code, state, strides, std::move(extra_args)};
   op_dispatch(args.gen_code, RandDispatch<KIND>{}, args);
 }
 
@@ -18,17 +18,24 @@
 
 #include "cunumeric/cunumeric.h"
 #include "cunumeric/random/philox.h"
-
-#define HI_BITS(x) (static_cast<unsigned>((x) >> 32))
-#define LO_BITS(x) (static_cast<unsigned>((x)&0x00000000FFFFFFFF))
+#ifndef __NVCC__
+#include "cunumeric/unary/vector_math.h"
+#endif
 
 namespace cunumeric {
 
 // Match these to RandGenCode in config.py
 enum class RandGenCode : int32_t {
-  UNIFORM = 1,
-  NORMAL  = 2,
-  INTEGER = 3,
+  UNIFORM         = 1,
+  NORMAL          = 2,
+  INTEGER         = 3,
+  EXPONENTIAL     = 4,
+  LOGNORMAL       = 5,
+  GAMMA           = 6,
+  BETA            = 7,
+  POISSON         = 8,
+  BINOMIAL        = 9,
+  NORMAL_ZIGGURAT = 10,
 };
 
 template <typename Functor, typename... Fnargs>
@@ -41,11 +48,273 @@ constexpr decltype(auto) op_dispatch(RandGenCode gen_code, Functor f, Fnargs&&..
       return f.template operator()<RandGenCode::NORMAL>(std::forward<Fnargs>(args)...);
     case RandGenCode::INTEGER:
       return f.template operator()<RandGenCode::INTEGER>(std::forward<Fnargs>(args)...);
+    case RandGenCode::EXPONENTIAL:
+      return f.template operator()<RandGenCode::EXPONENTIAL>(std::forward<Fnargs>(args)...);
+    case RandGenCode::LOGNORMAL:
+      return f.template operator()<RandGenCode::LOGNORMAL>(std::forward<Fnargs>(args)...);
+    case RandGenCode::GAMMA:
+      return f.template operator()<RandGenCode::GAMMA>(std::forward<Fnargs>(args)...);
+    case RandGenCode::BETA:
+      return f.template operator()<RandGenCode::BETA>(std::forward<Fnargs>(args)...);
+    case RandGenCode::POISSON:
+      return f.template operator()<RandGenCode::POISSON>(std::forward<Fnargs>(args)...);
+    case RandGenCode::BINOMIAL:
+      return f.template operator()<RandGenCode::BINOMIAL>(std::forward<Fnargs>(args)...);
+    case RandGenCode::NORMAL_ZIGGURAT:
+      return f.template operator()<RandGenCode::NORMAL_ZIGGURAT>(std::forward<Fnargs>(args)...);
   }
   assert(false);
   return f.template operator()<RandGenCode::UNIFORM>(std::forward<Fnargs>(args)...);
 }
 
+// All generators draw their bits from a Philox_4x32 engine. A generator consumes WORDS of the
+// four 32-bit words of an evaluation per value, so one evaluation yields 4 / WORDS values. The
+// element at linear offset i of the global array takes lane i % LANES of the evaluation for
+// counter i / LANES, which keeps the values independent of how the array is partitioned.
+// Generators that sample by rejection have WORDS == 0 and instead read as many words as they
+// need from a RandomStream of their own.
+using RandomEngine = Philox_4x32<10>;
+
+// The key of the engine and the first counter of the values to generate
+struct RandomState {
+  uint32_t key0;
+  uint32_t key1;
+  uint64_t counter;
+};
+
+template <legate::LegateTypeCode CODE>
+constexpr int32_t random_words = sizeof(legate::legate_type_of<CODE>) > sizeof(uint32_t) ? 2 : 1;
+
+template <legate::LegateTypeCode CODE>
+constexpr bool is_random_floating_point = CODE == legate::LegateTypeCode::HALF_LT ||
+                                          CODE == legate::LegateTypeCode::FLOAT_LT ||
+                                          CODE == legate::LegateTypeCode::DOUBLE_LT;
+
+// Samples are computed in double precision for doubles and in single precision otherwise
+template <legate::LegateTypeCode CODE>
+using random_compute_type =
+  std::conditional_t<CODE == legate::LegateTypeCode::DOUBLE_LT, double, float>;
+
+// Returns a value in [0, 1) made of the top bits of `bits`, which hold WORDS random words
+template <legate::LegateTypeCode CODE>
+__CUDAPREFIX__ inline legate::legate_type_of<CODE> bits_to_unit(uint64_t bits)
+{
+  if constexpr (CODE == legate::LegateTypeCode::DOUBLE_LT) {
+    // Use the bits as the mantissa of a double in [1, 2), which, unlike a conversion from an
+    // integer, vectorizes on the host without AVX-512
+    uint64_t pattern = 0x3FF0000000000000ULL | (bits >> 12);
+    double value;
+    memcpy(&value, &pattern, sizeof(double));
+    return value - 1.0;
+  } else if constexpr (CODE == legate::LegateTypeCode::FLOAT_LT) {
+    return static_cast<int32_t>(bits >> 8) * (1.0f / 16777216.0f);
+  } else {
+    // Eleven bits fit the mantissa of a half exactly, so the value never rounds up to 1
+    return __half{static_cast<int32_t>(bits >> 21) * (1.0f / 2048.0f)};
+  }
+}
+
+// Converts a sample computed in double precision to the output type
+template <legate::LegateTypeCode CODE>
+__CUDAPREFIX__ inline legate::legate_type_of<CODE> from_double(double value)
+{
+  using VAL = legate::legate_type_of<CODE>;
+  if constexpr (CODE == legate::LegateTypeCode::HALF_LT)
+    return VAL{static_cast<float>(value)};
+  else
+    return static_cast<VAL>(value);
+}
+
+// Treats `bits` as a 0.64 fixed-point value and returns its product with n, truncated
+__CUDAPREFIX__ inline uint64_t scale_bits(uint64_t bits, uint64_t n)
+{
+#ifdef __NVCC__
+  return __umul64hi(bits, n);
+#else
+  return Philox_2x32<10>::mul64hi(bits, n);
+#endif
+}
+
+template <int32_t WORDS>
+__CUDAPREFIX__ inline uint64_t lane_bits(const uint32_t words[4], uint32_t lane)
+{
+  if (WORDS == 1) return words[lane];
+  return (uint64_t{words[2 * lane]} << 32) | words[2 * lane + 1];
+}
+
+// The same for the j-th of a batch of evaluations stored lane-major
+template <int32_t WORDS, int32_t BATCH>
+__CUDAPREFIX__ inline uint64_t batch_bits(const uint32_t words[4][BATCH], uint32_t lane, int32_t j)
+{
+  if (WORDS == 1) return words[lane][j];
+  return (uint64_t{words[2 * lane][j]} << 32) | words[2 * lane + 1][j];
+}
+
+// Supplies any number of random words for one element. The words come from the evaluations
+// of the engine for the 128-bit counters (ctr, 0), (ctr, 1), ... in turn.
+class RandomStream {
+ public:
+  __CUDAPREFIX__ RandomStream(const RandomState& state, uint64_t ctr)
+    : key0(state.key0), key1(state.key1), ctr(ctr)
+  {
+  }
+
+  __CUDAPREFIX__ uint32_t next_word()
+  {
+    if (used == 4) {
+      RandomEngine::rand_raw(key0, key1, ctr, evaluations++, words);
+      used = 0;
+    }
+    return words[used++];
+  }
+
+  // Returns a double in the open interval (0, 1)
+  __CUDAPREFIX__ double next_double()
+  {
+    uint64_t hi = next_word();
+    uint64_t lo = next_word();
+    return ((((hi << 32) | lo) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+  }
+
+  // Returns a standard normal value with the Box-Muller transform
+  __CUDAPREFIX__ double next_normal()
+  {
+    double radius = sqrt(-2.0 * log(next_double()));
+    return radius * cos(2.0 * M_PI * next_double());
+  }
+
+ private:
+  uint32_t key0;
+  uint32_t key1;
+  uint64_t ctr;
+  uint64_t evaluations{0};
+  uint32_t words[4];
+  uint32_t used{4};
+};
+
+// Generators with PAIRED set turn the bits of lanes 2k and 2k + 1 into the values of both lanes
+// at once, so that transforms like Box-Muller can share their work between the two values
+template <typename GEN, typename = void>
+struct is_paired_generator : std::false_type {};
+
+template <typename GEN>
+struct is_paired_generator<GEN, std::void_t<decltype(GEN::PAIRED)>>
+  : std::integral_constant<bool, GEN::PAIRED> {};
+
+// Returns the value of `gen` for lane `lane` of an evaluation
+template <typename GEN>
+__CUDAPREFIX__ inline typename GEN::VAL generate_lane(const GEN& gen,
+                                                      const uint32_t words[4],
+                                                      uint32_t lane)
+{
+  if constexpr (is_paired_generator<GEN>::value) {
+    const uint32_t first = lane & ~1U;
+    typename GEN::VAL values[2];
+    gen(lane_bits<GEN::WORDS>(words, first),
+        lane_bits<GEN::WORDS>(words, first + 1),
+        values[0],
+        values[1]);
+    return values[lane - first];
+  } else {
+    return gen(lane_bits<GEN::WORDS>(words, lane));
+  }
+}
+
+// Returns the value of `gen` for linear offset `offset` of the global array
+template <typename GEN>
+__CUDAPREFIX__ inline typename GEN::VAL generate(const RandomState& state,
+                                                 const GEN& gen,
+                                                 uint64_t offset)
+{
+  if constexpr (GEN::WORDS == 0) {
+    RandomStream stream(state, state.counter + offset);
+    return gen(stream);
+  } else {
+    constexpr uint32_t LANES = 4 / GEN::WORDS;
+    uint32_t words[4];
+    RandomEngine::rand_raw(state.key0, state.key1, state.counter + offset / LANES, 0, words);
+    return generate_lane(gen, words, offset % LANES);
+  }
+}
+
+// Stores the values of `gen` for the linear offsets [offset, offset + count) in `out`. The
+// engine is evaluated for BATCH counters at once and every lane of each evaluation is used.
+template <typename GEN, typename VAL>
+void generate_range(
+  const RandomState& state, const GEN& gen, uint64_t offset, size_t count, VAL* out)
+{
+  if constexpr (GEN::WORDS == 0) {
+    for (size_t idx = 0; idx < count; ++idx) out[idx] = generate(state, gen, offset + idx);
+  } else {
+    constexpr uint32_t LANES = 4 / GEN::WORDS;
+    constexpr int32_t BATCH  = 16;
+
+    const uint64_t end = offset + count;
+    uint32_t words[4][BATCH];
+    VAL values[LANES][BATCH];
+    for (uint64_t ctr = offset / LANES; ctr * LANES < end; ctr += BATCH) {
+      RandomEngine::rand_raw_n<BATCH>(state.key0, state.key1, state.counter + ctr, words);
+      const uint64_t first = ctr * LANES;
+      if (first >= offset && first + BATCH * LANES <= end) {
+        // A batch inside the range is transformed lane by lane, with no branches in the inner
+        // loops so that they vectorize, and then interleaved into the output
+        if constexpr (is_paired_generator<GEN>::value) {
+          for (uint32_t lane = 0; lane < LANES; lane += 2)
+#pragma omp simd
+            for (int32_t j = 0; j < BATCH; ++j)
+              gen(batch_bits<GEN::WORDS>(words, lane, j),
+                  batch_bits<GEN::WORDS>(words, lane + 1, j),
+                  values[lane][j],
+                  values[lane + 1][j]);
+        } else {
+          for (uint32_t lane = 0; lane < LANES; ++lane)
+#pragma omp simd
+            for (int32_t j = 0; j < BATCH; ++j)
+              values[lane][j] = gen(batch_bits<GEN::WORDS>(words, lane, j));
+        }
+        VAL* batch = out + (first - offset);
+        for (int32_t j = 0; j < BATCH; ++j)
+          for (uint32_t lane = 0; lane < LANES; ++lane) batch[j * LANES + lane] = values[lane][j];
+        continue;
+      }
+      // A batch at either end of the range
+      for (int32_t j = 0; j < BATCH; ++j) {
+        const uint32_t evaluation[4] = {words[0][j], words[1][j], words[2][j], words[3][j]};
+        for (uint32_t lane = 0; lane < LANES; ++lane) {
+          const uint64_t idx = first + j * LANES + lane;
+          if (idx < offset || idx >= end) continue;
+          out[idx - offset] = generate_lane(gen, evaluation, lane);
+        }
+      }
+    }
+  }
+}
+
+// Samples the gamma distribution with unit scale using the method of Marsaglia and Tsang
+__CUDAPREFIX__ inline double sample_gamma(RandomStream& stream, double shape)
+{
+  if (shape <= 0.0) return 0.0;
+  // Shapes below one are boosted by one and the sample scaled back down
+  double boost = 1.0;
+  if (shape < 1.0) {
+    boost = pow(stream.next_double(), 1.0 / shape);
+    shape += 1.0;
+  }
+  const double d = shape - 1.0 / 3.0;
+  const double c = 1.0 / sqrt(9.0 * d);
+  while (true) {
+    double x, v;
+    do {
+      x = stream.next_normal();
+      v = 1.0 + c * x;
+    } while (v <= 0.0);
+    v              = v * v * v;
+    const double u = stream.next_double();
+    if (u < 1.0 - 0.0331 * (x * x) * (x * x)) return d * v * boost;
+    if (log(u) < 0.5 * x * x + d * (1.0 - v + log(v))) return d * v * boost;
+  }
+}
+
 template <RandGenCode GEN_CODE, legate::LegateTypeCode CODE>
 struct RandomGenerator {
   static constexpr bool valid = false;
@@ -53,149 +322,429 @@ struct RandomGenerator {
 
 template <legate::LegateTypeCode CODE>
 struct RandomGenerator<RandGenCode::UNIFORM, CODE> {
-  using RNG                   = Philox_2x32<10>;
-  static constexpr bool valid = CODE == legate::LegateTypeCode::DOUBLE_LT;
+  using VAL = legate::legate_type_of<CODE>;
+  using ACC = random_compute_type<CODE>;
 
-  RandomGenerator(uint32_t ep, const std::vector<legate::Store>& args) : epoch(ep) {}
+  static constexpr bool valid    = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS = random_words<CODE>;
 
-  __CUDAPREFIX__ double operator()(uint32_t hi, uint32_t lo) const
+  RandomGenerator(const std::vector<legate::Store>& args)
   {
-    return RNG::rand_double(epoch, hi, lo);
+    if (args.empty()) return;
+    assert(args.size() == 2);
+    low  = args[0].scalar<double>();
+    span = args[1].scalar<double>() - low;
+  }
+
+  __CUDAPREFIX__ VAL operator()(uint64_t bits) const
+  {
+    return VAL(low + span * static_cast<ACC>(bits_to_unit<CODE>(bits)));
   };
 
-  uint32_t epoch;
+  ACC low{0};
+  ACC span{1};
 };
 
+// Samples the normal distribution with the Box-Muller transform, which turns the uniform values of
+// two lanes into two independent normal values
 template <legate::LegateTypeCode CODE>
 struct RandomGenerator<RandGenCode::NORMAL, CODE> {
-  using RNG                   = Philox_2x32<10>;
-  static constexpr bool valid = CODE == legate::LegateTypeCode::DOUBLE_LT;
+  using VAL = legate::legate_type_of<CODE>;
+  using ACC = random_compute_type<CODE>;
 
-  RandomGenerator(uint32_t ep, const std::vector<legate::Store>& args) : epoch(ep) {}
+  static constexpr bool valid    = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS = random_words<CODE>;
+  static constexpr bool PAIRED   = true;
 
-#ifndef __NVCC__
-  static inline double erfinv(double a)
-  {
-    double p, q, t, fa;
-    unsigned long long int l;
-
-    fa = fabs(a);
-    if (fa >= 1.0) {
-      l = 0xfff8000000000000ull;
-      memcpy(&t, &l, sizeof(double)); /* INDEFINITE */
-      if (fa == 1.0) { t = a * exp(1000.0); /* Infinity */ }
-    } else if (fa >= 0.9375) {
-      /* Based on: J.M. Blair, C.A. Edwards, J.H. Johnson: Rational Chebyshev
-         Approximations for the Inverse of the Error Function. Mathematics of
-         Computation, Vol. 30, No. 136 (Oct. 1976), pp. 827-830. Table 59
-       */
-      t = log1p(-fa);
-      t = 1.0 / sqrt(-t);
-      p = 2.7834010353747001060e-3;
-      p = p * t + 8.6030097526280260580e-1;
-      p = p * t + 2.1371214997265515515e+0;
-      p = p * t + 3.1598519601132090206e+0;
-      p = p * t + 3.5780402569085996758e+0;
-      p = p * t + 1.5335297523989890804e+0;
-      p = p * t + 3.4839207139657522572e-1;
-      p = p * t + 5.3644861147153648366e-2;
-      p = p * t + 4.3836709877126095665e-3;
-      p = p * t + 1.3858518113496718808e-4;
-      p = p * t + 1.1738352509991666680e-6;
-      q = t + 2.2859981272422905412e+0;
-      q = q * t + 4.3859045256449554654e+0;
-      q = q * t + 4.6632960348736635331e+0;
-      q = q * t + 3.9846608184671757296e+0;
-      q = q * t + 1.6068377709719017609e+0;
-      q = q * t + 3.5609087305900265560e-1;
-      q = q * t + 5.3963550303200816744e-2;
-      q = q * t + 4.3873424022706935023e-3;
-      q = q * t + 1.3858762165532246059e-4;
-      q = q * t + 1.1738313872397777529e-6;
-      t = p / (q * t);
-      if (a < 0.0) t = -t;
-    } else if (fa >= 0.75) {
-      /* Based on: J.M. Blair, C.A. Edwards, J.H. Johnson: Rational Chebyshev
-         Approximations for the Inverse of the Error Function. Mathematics of
-         Computation, Vol. 30, No. 136 (Oct. 1976), pp. 827-830. Table 39
-      */
-      t = a * a - .87890625;
-      p = .21489185007307062000e+0;
-      p = p * t - .64200071507209448655e+1;
-      p = p * t + .29631331505876308123e+2;
-      p = p * t - .47644367129787181803e+2;
-      p = p * t + .34810057749357500873e+2;
-      p = p * t - .12954198980646771502e+2;
-      p = p * t + .25349389220714893917e+1;
-      p = p * t - .24758242362823355486e+0;
-      p = p * t + .94897362808681080020e-2;
-      q = t - .12831383833953226499e+2;
-      q = q * t + .41409991778428888716e+2;
-      q = q * t - .53715373448862143349e+2;
-      q = q * t + .33880176779595142685e+2;
-      q = q * t - .11315360624238054876e+2;
-      q = q * t + .20369295047216351160e+1;
-      q = q * t - .18611650627372178511e+0;
-      q = q * t + .67544512778850945940e-2;
-      p = p / q;
-      t = a * p;
-    } else {
-      /* Based on: J.M. Blair, C.A. Edwards, J.H. Johnson: Rational Chebyshev
-         Approximations for the Inverse of the Error Function. Mathematics of
-         Computation, Vol. 30, No. 136 (Oct. 1976), pp. 827-830. Table 18
-      */
-      t = a * a - .5625;
-      p = -.23886240104308755900e+2;
-      p = p * t + .45560204272689128170e+3;
-      p = p * t - .22977467176607144887e+4;
-      p = p * t + .46631433533434331287e+4;
-      p = p * t - .43799652308386926161e+4;
-      p = p * t + .19007153590528134753e+4;
-      p = p * t - .30786872642313695280e+3;
-      q = t - .83288327901936570000e+2;
-      q = q * t + .92741319160935318800e+3;
-      q = q * t - .35088976383877264098e+4;
-      q = q * t + .59039348134843665626e+4;
-      q = q * t - .48481635430048872102e+4;
-      q = q * t + .18997769186453057810e+4;
-      q = q * t - .28386514725366621129e+3;
-      p = p / q;
-      t = a * p;
-    }
-    return t;
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    if (args.empty()) return;
+    assert(args.size() == 2);
+    mean   = args[0].scalar<double>();
+    stddev = args[1].scalar<double>();
   }
+
+  __CUDAPREFIX__ static void sample(uint64_t bits0, uint64_t bits1, ACC& z0, ACC& z1)
+  {
+    // Halves take their values from all 32 bits rather than from eleven
+    constexpr auto UNIT_CODE = CODE == legate::LegateTypeCode::DOUBLE_LT
+                                 ? legate::LegateTypeCode::DOUBLE_LT
+                                 : legate::LegateTypeCode::FLOAT_LT;
+    // 1 - u is in (0, 1], so the radius is finite
+    const ACC u0 = ACC{1} - bits_to_unit<UNIT_CODE>(bits0);
+    const ACC u1 = bits_to_unit<UNIT_CODE>(bits1);
+    ACC radius, c, s;
+#ifdef __NVCC__
+    radius = sqrt(ACC{-2} * log(u0));
+    if constexpr (std::is_same<ACC, float>::value)
+      sincospif(2.0f * u1, &s, &c);
+    else
+      sincospi(2.0 * u1, &s, &c);
+#else
+    // The polynomial kernels keep the transform vectorizable on the host
+    using vector_math::Function;
+    radius         = std::sqrt(ACC{-2} * vector_math::apply<Function::LOG, false>(u0));
+    const ACC turn = static_cast<ACC>(2.0 * M_PI) * u1;
+    c              = vector_math::apply<Function::COS, false>(turn);
+    s              = vector_math::apply<Function::SIN, false>(turn);
 #endif
+    z0 = radius * c;
+    z1 = radius * s;
+  }
+
+  __CUDAPREFIX__ void operator()(uint64_t bits0, uint64_t bits1, VAL& value0, VAL& value1) const
+  {
+    ACC z0, z1;
+    sample(bits0, bits1, z0, z1);
+    value0 = VAL(mean + stddev * z0);
+    value1 = VAL(mean + stddev * z1);
+  };
+
+  ACC mean{0};
+  ACC stddev{1};
+};
+
+// Samples the normal distribution with the ziggurat method of Marsaglia and Tsang, using the
+// 128-layer variant of Doornik. The few samples that fall outside the rectangles read more words,
+// so each element has a stream of its own. That costs a full evaluation of the engine per sample,
+// of which most samples use only two words, whereas Box-Muller uses every word of an evaluation.
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::NORMAL_ZIGGURAT, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid     = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS  = 0;
+  static constexpr int32_t LAYERS = 128;
+
+  // The right edge of the base layer and the area of each layer
+  static constexpr double R    = 3.442619855899;
+  static constexpr double AREA = 9.91256303526217e-3;
 
-  __CUDAPREFIX__ double operator()(uint32_t hi, uint32_t lo) const
+  static double density(double x) { return std::exp(-0.5 * x * x); }
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    if (!args.empty()) {
+      assert(args.size() == 2);
+      mean   = args[0].scalar<double>();
+      stddev = args[1].scalar<double>();
+    }
+    // The base layer is as wide as a rectangle of the same area, which makes its tail beyond R
+    // part of the same draw
+    edges[0]      = AREA / density(R);
+    edges[1]      = R;
+    edges[LAYERS] = 0.0;
+    for (int32_t i = 2; i < LAYERS; ++i)
+      edges[i] = std::sqrt(-2.0 * std::log(AREA / edges[i - 1] + density(edges[i - 1])));
+    for (int32_t i = 0; i < LAYERS; ++i) ratios[i] = edges[i + 1] / edges[i];
+  }
+
+  __CUDAPREFIX__ double sample(RandomStream& stream) const
+  {
+    while (true) {
+      uint64_t hi         = stream.next_word();
+      const uint64_t bits = (hi << 32) | stream.next_word();
+      // The low seven bits pick the layer and the top 53 bits a position within it
+      const int32_t layer = bits & (LAYERS - 1);
+      const double u      = 2.0 * ((bits >> 11) * (1.0 / 9007199254740992.0)) - 1.0;
+      if (fabs(u) < ratios[layer]) return u * edges[layer];
+      if (layer == 0) {
+        // The tail beyond R, sampled with Marsaglia's method
+        double x, y;
+        do {
+          x = log(stream.next_double()) / R;
+          y = log(stream.next_double());
+        } while (-2.0 * y < x * x);
+        return u < 0.0 ? x - R : R - x;
+      }
+      // The wedge between the rectangle and the density
+      const double x  = u * edges[layer];
+      const double f0 = exp(-0.5 * (edges[layer] * edges[layer] - x * x));
+      const double f1 = exp(-0.5 * (edges[layer + 1] * edges[layer + 1] - x * x));
+      if (f1 + stream.next_double() * (f0 - f1) < 1.0) return x;
+    }
+  }
+
+  __CUDAPREFIX__ VAL operator()(RandomStream& stream) const
   {
-    return erfinv(2.0 * RNG::rand_double(epoch, hi, lo) - 1.0);
+    return from_double<CODE>(mean + stddev * sample(stream));
   };
 
-  uint32_t epoch;
+  double mean{0};
+  double stddev{1};
+  double edges[LAYERS + 1];
+  double ratios[LAYERS];
 };
 
 template <legate::LegateTypeCode CODE>
 struct RandomGenerator<RandGenCode::INTEGER, CODE> {
-  using RNG = Philox_2x32<10>;
   using VAL = legate::legate_type_of<CODE>;
 
-  static constexpr bool valid = legate::is_integral<CODE>::value;
+  static constexpr bool valid    = legate::is_integral<CODE>::value;
+  static constexpr int32_t WORDS = random_words<CODE>;
 
-  RandomGenerator(uint32_t ep, const std::vector<legate::Store>& args) : epoch(ep)
+  RandomGenerator(const std::vector<legate::Store>& args)
   {
     assert(args.size() == 2);
-    lo   = args[0].scalar<VAL>();
-    diff = args[1].scalar<VAL>() - lo;
+    lo   = args[0].scalar<int64_t>();
+    diff = args[1].scalar<int64_t>() - lo;
   }
 
-  __CUDAPREFIX__ double operator()(uint32_t hi_bits, uint32_t lo_bits) const
+  __CUDAPREFIX__ VAL operator()(uint64_t bits) const
   {
-    return static_cast<VAL>(lo + RNG::rand_long(epoch, hi_bits, lo_bits, diff));
+    // A single word is enough for types of up to 32 bits, whose ranges fit in 32 bits
+    if (WORDS == 1) return static_cast<VAL>(lo + ((bits * diff) >> 32));
+    return static_cast<VAL>(lo + scale_bits(bits, diff));
   };
 
-  uint32_t epoch;
-  VAL lo;
+  int64_t lo;
   uint64_t diff;
 };
 
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::EXPONENTIAL, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+  using ACC = random_compute_type<CODE>;
+
+  static constexpr bool valid    = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS = random_words<CODE>;
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 1);
+    scale = args[0].scalar<double>();
+  }
+
+  __CUDAPREFIX__ VAL operator()(uint64_t bits) const
+  {
+    using std::log;
+    // Halves take their value from all 32 bits rather than from eleven
+    constexpr auto UNIT_CODE = CODE == legate::LegateTypeCode::DOUBLE_LT
+                                 ? legate::LegateTypeCode::DOUBLE_LT
+                                 : legate::LegateTypeCode::FLOAT_LT;
+    const ACC u = bits_to_unit<UNIT_CODE>(bits);
+    return VAL(-log(ACC{1} - u) * scale);
+  };
+
+  ACC scale;
+};
+
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::LOGNORMAL, CODE>
+  : public RandomGenerator<RandGenCode::NORMAL, CODE> {
+  using NORMAL = RandomGenerator<RandGenCode::NORMAL, CODE>;
+  using VAL    = legate::legate_type_of<CODE>;
+  using ACC    = random_compute_type<CODE>;
+
+  RandomGenerator(const std::vector<legate::Store>& args) : NORMAL(args) {}
+
+  __CUDAPREFIX__ void operator()(uint64_t bits0, uint64_t bits1, VAL& value0, VAL& value1) const
+  {
+    using std::exp;
+    ACC z0, z1;
+    NORMAL::sample(bits0, bits1, z0, z1);
+    value0 = VAL(exp(NORMAL::mean + NORMAL::stddev * z0));
+    value1 = VAL(exp(NORMAL::mean + NORMAL::stddev * z1));
+  };
+};
+
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::GAMMA, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid    = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS = 0;
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 2);
+    shape = args[0].scalar<double>();
+    scale = args[1].scalar<double>();
+  }
+
+  __CUDAPREFIX__ VAL operator()(RandomStream& stream) const
+  {
+    return from_double<CODE>(sample_gamma(stream, shape) * scale);
+  };
+
+  double shape;
+  double scale;
+};
+
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::BETA, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid    = is_random_floating_point<CODE>;
+  static constexpr int32_t WORDS = 0;
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 2);
+    a = args[0].scalar<double>();
+    b = args[1].scalar<double>();
+  }
+
+  __CUDAPREFIX__ VAL operator()(RandomStream& stream) const
+  {
+    if (a > 1.0 || b > 1.0) {
+      const double x = sample_gamma(stream, a);
+      const double y = sample_gamma(stream, b);
+      return from_double<CODE>(x / (x + y));
+    }
+    // Johnk's algorithm, which handles small parameters in logarithmic space when the powers
+    // underflow
+    while (true) {
+      const double u  = stream.next_double();
+      const double v  = stream.next_double();
+      const double x  = pow(u, 1.0 / a);
+      const double y  = pow(v, 1.0 / b);
+      const double xy = x + y;
+      if (xy > 1.0) continue;
+      if (xy > 0.0) return from_double<CODE>(x / xy);
+      double log_x = log(u) / a;
+      double log_y = log(v) / b;
+      double log_m = log_x > log_y ? log_x : log_y;
+      log_x -= log_m;
+      log_y -= log_m;
+      return from_double<CODE>(exp(log_x - log(exp(log_x) + exp(log_y))));
+    }
+  };
+
+  double a;
+  double b;
+};
+
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::POISSON, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid    = legate::is_integral<CODE>::value;
+  static constexpr int32_t WORDS = 0;
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 1);
+    lam = args[0].scalar<double>();
+  }
+
+  __CUDAPREFIX__ VAL operator()(RandomStream& stream) const
+  {
+    if (lam <= 0.0) return VAL{0};
+    if (lam < 10.0) {
+      // Count the uniform values whose running product stays above exp(-lam)
+      const double limit = exp(-lam);
+      double product     = stream.next_double();
+      int64_t k          = 0;
+      while (product > limit) {
+        product *= stream.next_double();
+        ++k;
+      }
+      return static_cast<VAL>(k);
+    }
+    // Hormann's transformed rejection with squeeze (PTRS)
+    const double slam      = sqrt(lam);
+    const double log_lam   = log(lam);
+    const double b         = 0.931 + 2.53 * slam;
+    const double a         = -0.059 + 0.02483 * b;
+    const double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    const double v_r       = 0.9277 - 3.6224 / (b - 2.0);
+    while (true) {
+      const double u  = stream.next_double() - 0.5;
+      const double v  = stream.next_double();
+      const double us = 0.5 - fabs(u);
+      const double k  = floor((2.0 * a / us + b) * u + lam + 0.43);
+      if (us >= 0.07 && v <= v_r) return static_cast<VAL>(k);
+      if (k < 0.0 || (us < 0.013 && v > us)) continue;
+      if (log(v) + log(inv_alpha) - log(a / (us * us) + b) <= -lam + k * log_lam - lgamma(k + 1.0))
+        return static_cast<VAL>(k);
+    }
+  };
+
+  double lam;
+};
+
+template <legate::LegateTypeCode CODE>
+struct RandomGenerator<RandGenCode::BINOMIAL, CODE> {
+  using VAL = legate::legate_type_of<CODE>;
+
+  static constexpr bool valid    = legate::is_integral<CODE>::value;
+  static constexpr int32_t WORDS = 0;
+
+  RandomGenerator(const std::vector<legate::Store>& args)
+  {
+    assert(args.size() == 2);
+    n = args[0].scalar<double>();
+    p = args[1].scalar<double>();
+  }
+
+  // Returns log(k!) - (k + 1/2) log(k + 1) + (k + 1) - log(2 pi) / 2, the error of Stirling's
+  // approximation
+  __CUDAPREFIX__ static double stirling_tail(double k)
+  {
+    const double values[] = {0.0810614667953272,
+                             0.0413406959554092,
+                             0.0276779256849983,
+                             0.02079067210376509,
+                             0.0166446911898211,
+                             0.0138761288230707,
+                             0.0118967099458917,
+                             0.0104112652619720,
+                             0.00925546218271273,
+                             0.00833056343336287};
+    if (k <= 9.0) return values[static_cast<int32_t>(k)];
+    const double kp1sq = (k + 1.0) * (k + 1.0);
+    return (1.0 / 12.0 - (1.0 / 360.0 - 1.0 / 1260.0 / kp1sq) / kp1sq) / (k + 1.0);
+  }
+
+  // Samples with p <= 1/2
+  __CUDAPREFIX__ double sample(RandomStream& stream, double p) const
+  {
+    if (p <= 0.0) return 0.0;
+    if (n * p < 10.0) {
+      // Count the geometric gaps between successes that fit in n trials
+      const double log_q = log1p(-p);
+      double trials      = 0.0;
+      double k           = 0.0;
+      while (true) {
+        trials += ceil(log(stream.next_double()) / log_q);
+        if (trials > n) return k;
+        k += 1.0;
+      }
+    }
+    // Hormann's transformed rejection (BTRS)
+    const double stddev = sqrt(n * p * (1.0 - p));
+    const double b      = 1.15 + 2.53 * stddev;
+    const double a      = -0.0873 + 0.0248 * b + 0.01 * p;
+    const double c      = n * p + 0.5;
+    const double v_r    = 0.92 - 4.2 / b;
+    const double r      = p / (1.0 - p);
+    const double alpha  = (2.83 + 5.1 / b) * stddev;
+    const double m      = floor((n + 1.0) * p);
+    while (true) {
+      const double u  = stream.next_double() - 0.5;
+      double v        = stream.next_double();
+      const double us = 0.5 - fabs(u);
+      const double k  = floor((2.0 * a / us + b) * u + c);
+      if (us >= 0.07 && v <= v_r) return k;
+      if (k < 0.0 || k > n) continue;
+      v                  = log(v * alpha / (a / (us * us) + b));
+      const double bound = (m + 0.5) * log((m + 1.0) / (r * (n - m + 1.0))) +
+                           (n + 1.0) * log((n - m + 1.0) / (n - k + 1.0)) +
+                           (k + 0.5) * log(r * (n - k + 1.0) / (k + 1.0)) + stirling_tail(m) +
+                           stirling_tail(n - m) - stirling_tail(k) - stirling_tail(n - k);
+      if (v <= bound) return k;
+    }
+  }
+
+  __CUDAPREFIX__ VAL operator()(RandomStream& stream) const
+  {
+    if (p > 0.5) return static_cast<VAL>(n - sample(stream, 1.0 - p));
+    return static_cast<VAL>(sample(stream, p));
+  };
+
+  double n;
+  double p;
+};
+
 }  // namespace cunumeric
@@ -16,6 +16,7 @@
 
 #include "cunumeric/sort/sort.h"
 #include "cunumeric/sort/sort_template.inl"
+#include "cunumeric/utilities/scratch_arena.h"
 
 #include <thrust/sort.h>
 #include <thrust/execution_policy.h>
@@ -82,10 +83,11 @@ struct SortImplBody<VariantKind::CPU, CODE, DIM> {
 
     if (argsort) {
       // make copy of the input
-      auto dense_input_copy = create_buffer<VAL>(volume);
+      ScratchScope scratch;
+      auto dense_input_copy = scratch.allocate<VAL>(volume);
       {
         auto* src = input.ptr(rect.lo);
-        std::copy(src, src + volume, dense_input_copy.ptr(0));
+        std::copy(src, src + volume, dense_input_copy);
       }
 
       AccessorWO<int64_t, DIM> output = output_array.write_accessor<int64_t, DIM>(rect);
@@ -93,7 +95,7 @@ struct SortImplBody<VariantKind::CPU, CODE, DIM> {
 
       // sort data in place
       thrust_local_sort_inplace(
-        dense_input_copy.ptr(0), output.ptr(rect.lo), volume, segment_size_l, stable);
+        dense_input_copy, output.ptr(rect.lo), volume, segment_size_l, stable);
 
     } else {
       AccessorWO<VAL, DIM> output = output_array.write_accessor<VAL, DIM>(rect);
@@ -16,6 +16,8 @@
 
 #include "cunumeric/sort/sort.h"
 #include "cunumeric/sort/sort_template.inl"
+#include "cunumeric/omp_help.h"
+#include "cunumeric/utilities/thrust_allocator.h"
 
 #include <thrust/sort.h>
 #include <thrust/execution_policy.h>
@@ -39,10 +41,13 @@ struct SortImplBody<VariantKind::OMP, CODE, DIM> {
                                  const size_t sort_dim_size,
                                  const bool stable_argsort)
   {
+    // Thrust allocates its temporaries for every segment, which the arena turns into bumps
+    ScratchScope scratch;
+    ScratchAllocator alloc;
     if (argptr == nullptr) {
       // sort (in place)
       for (size_t start_idx = 0; start_idx < volume; start_idx += sort_dim_size) {
-        thrust::sort(thrust::omp::par, inptr + start_idx, inptr + start_idx + sort_dim_size);
+        thrust::sort(thrust::omp::par(alloc), inptr + start_idx, inptr + start_idx + sort_dim_size);
       }
     } else {
       // argsort
@@ -52,10 +57,10 @@ struct SortImplBody<VariantKind::OMP, CODE, DIM> {
         std::iota(segmentValues, segmentValues + sort_dim_size, 0);  // init
         if (stable_argsort) {
           thrust::stable_sort_by_key(
-            thrust::omp::par, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+            thrust::omp::par(alloc), segmentKeys, segmentKeys + sort_dim_size, segmentValues);
         } else {
           thrust::sort_by_key(
-            thrust::omp::par, segmentKeys, segmentKeys + sort_dim_size, segmentValues);
+            thrust::omp::par(alloc), segmentKeys, segmentKeys + sort_dim_size, segmentValues);
         }
       }
     }
@@ -82,11 +87,13 @@ struct SortImplBody<VariantKind::OMP, CODE, DIM> {
     assert(!is_index_space || DIM > 1);
 
     if (argsort) {
-      // make copy of the input
-      auto dense_input_copy = create_buffer<VAL>(volume);
+      // make copy of the input, in parallel so that the pages of the copy are local to the threads
+      auto dense_input_copy = create_buffer<VAL>(volume, scratch_memory_kind_omp());
       {
         auto* src = input.ptr(rect.lo);
-        std::copy(src, src + volume, dense_input_copy.ptr(0));
+        auto* dst = dense_input_copy.ptr(0);
+#pragma omp parallel for schedule(static)
+        for (size_t idx = 0; idx < volume; ++idx) dst[idx] = src[idx];
       }
 
       AccessorWO<int64_t, DIM> output = output_array.write_accessor<int64_t, DIM>(rect);
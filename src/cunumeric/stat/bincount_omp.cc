@@ -35,14 +35,12 @@ struct BincountImplBody<VariantKind::OMP, CODE> {
     const int max_threads   = omp_get_max_threads();
     const size_t lhs_volume = lhs_rect.volume();
     std::vector<std::vector<int64_t>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<int64_t>::identity;
-      local_bins = std::vector<int64_t>(lhs_volume, init);
-    }
 #pragma omp parallel
     {
       auto tid                         = omp_get_thread_num();
       std::vector<int64_t>& local_bins = all_local_bins[tid];
+      // Each thread allocates and initializes its own bins, so that they are local to its socket
+      local_bins = std::vector<int64_t>(lhs_volume, SumReduction<int64_t>::identity);
 #pragma omp for schedule(static)
       for (size_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
         auto value = rhs[idx];
@@ -61,14 +59,12 @@ struct BincountImplBody<VariantKind::OMP, CODE> {
     const int max_threads   = omp_get_max_threads();
     const size_t lhs_volume = lhs_rect.volume();
     std::vector<std::vector<double>> all_local_bins(max_threads);
-    for (auto& local_bins : all_local_bins) {
-      auto init  = SumReduction<double>::identity;
-      local_bins = std::vector<double>(lhs_volume, init);
-    }
 #pragma omp parallel
     {
       auto tid                        = omp_get_thread_num();
       std::vector<double>& local_bins = all_local_bins[tid];
+      // Each thread allocates and initializes its own bins, so that they are local to its socket
+      local_bins = std::vector<double>(lhs_volume, SumReduction<double>::identity);
 #pragma omp for schedule(static)
       for (size_t idx = rect.lo[0]; idx <= rect.hi[0]; ++idx) {
         auto value = rhs[idx];
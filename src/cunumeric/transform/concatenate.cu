@@ -0,0 +1,70 @@
+/* Copyright 2021-2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/transform/concatenate.h"
+#include "cunumeric/transform/concatenate_template.inl"
+
+#include "cunumeric/cuda_help.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <typename WriteAcc, typename ReadAcc, typename Pitches, typename Rect, typename Point>
+static __global__ void __launch_bounds__(THREADS_PER_BLOCK, MIN_CTAS_PER_SM)
+  concatenate_kernel(
+    const size_t volume, WriteAcc out, ReadAcc in, Pitches pitches, Rect rect, Point offset)
+{
+  const size_t idx = global_tid_1d();
+  if (idx >= volume) return;
+  auto p = pitches.unflatten(idx, rect.lo);
+  out[p] = in[p - offset];
+}
+
+template <LegateTypeCode CODE, int32_t DIM>
+struct ConcatenateImplBody<VariantKind::GPU, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(AccessorWO<VAL, DIM> out,
+                  const std::vector<ConcatenatePiece<VAL, DIM>>& pieces) const
+  {
+    auto stream = get_cached_stream();
+    for (auto& piece : pieces) {
+      Pitches<DIM - 1> pitches;
+      const size_t volume = pitches.flatten(piece.rect);
+      if (piece.run == volume) {
+        CHECK_CUDA(cudaMemcpyAsync(out.ptr(piece.rect.lo),
+                                   piece.in.ptr(piece.rect.lo - piece.offset),
+                                   volume * sizeof(VAL),
+                                   cudaMemcpyDefault,
+                                   stream));
+      } else {
+        const size_t blocks = (volume + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+        concatenate_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+          volume, out, piece.in, pitches, piece.rect, piece.offset);
+      }
+    }
+    CHECK_CUDA_STREAM(stream);
+  }
+};
+
+/*static*/ void ConcatenateTask::gpu_variant(TaskContext& context)
+{
+  concatenate_template<VariantKind::GPU>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,54 @@
+/* Copyright 2021-2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/transform/concatenate.h"
+#include "cunumeric/transform/concatenate_template.inl"
+
+#include <cstring>
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+template <LegateTypeCode CODE, int32_t DIM>
+struct ConcatenateImplBody<VariantKind::OMP, CODE, DIM> {
+  using VAL = legate_type_of<CODE>;
+
+  void operator()(AccessorWO<VAL, DIM> out,
+                  const std::vector<ConcatenatePiece<VAL, DIM>>& pieces) const
+  {
+    // Pieces cover disjoint parts of the output, so threads move on to the next one without
+    // waiting for the others
+#pragma omp parallel
+    for (auto& piece : pieces) {
+      Pitches<DIM - 1> pitches;
+      const size_t runs = pitches.flatten(piece.rect) / piece.run;
+#pragma omp for schedule(static) nowait
+      for (size_t idx = 0; idx < runs; ++idx) {
+        auto p = pitches.unflatten(idx * piece.run, piece.rect.lo);
+        memcpy(out.ptr(p), piece.in.ptr(p - piece.offset), piece.run * sizeof(VAL));
+      }
+    }
+  }
+};
+
+/*static*/ void ConcatenateTask::omp_variant(TaskContext& context)
+{
+  concatenate_template<VariantKind::OMP>(context);
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,96 @@
+/* Copyright 2021-2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Useful for IDEs
+#include "cunumeric/transform/concatenate.h"
+#include "cunumeric/pitches.h"
+
+namespace cunumeric {
+
+using namespace Legion;
+using namespace legate;
+
+// The part of an output tile that is copied from one input
+template <typename VAL, int DIM>
+struct ConcatenatePiece {
+  AccessorRO<VAL, DIM> in;
+  // Points of the output tile covered by the input
+  Rect<DIM> rect;
+  // Position of the input in the output
+  Point<DIM> offset;
+  // Number of elements that are consecutive in both the input and the output
+  size_t run;
+};
+
+template <VariantKind KIND, LegateTypeCode CODE, int DIM>
+struct ConcatenateImplBody;
+
+template <typename VAL, int DIM, typename ACC>
+static Point<DIM> element_strides(const ACC& acc)
+{
+  Point<DIM> strides;
+  for (int32_t dim = 0; dim < DIM; ++dim) strides[dim] = acc.accessor.strides[dim] / sizeof(VAL);
+  return strides;
+}
+
+template <VariantKind KIND>
+struct ConcatenateImpl {
+  template <LegateTypeCode CODE, int DIM>
+  void operator()(ConcatenateArgs& args) const
+  {
+    using VAL = legate_type_of<CODE>;
+
+    auto out_rect = args.out.shape<DIM>();
+    if (out_rect.empty()) return;
+
+    auto out         = args.out.write_accessor<VAL, DIM>(out_rect);
+    auto out_strides = element_strides<VAL, DIM>(out);
+
+    std::vector<ConcatenatePiece<VAL, DIM>> pieces;
+    for (size_t idx = 0; idx < args.inputs.size(); ++idx) {
+      auto offset       = Point<DIM>::ZEROES();
+      offset[args.axis] = args.offsets[idx];
+
+      auto in_rect = args.inputs[idx].shape<DIM>();
+      auto rect    = Rect<DIM>(in_rect.lo + offset, in_rect.hi + offset).intersection(out_rect);
+      if (rect.empty()) continue;
+
+      auto in =
+        args.inputs[idx].read_accessor<VAL, DIM>(Rect<DIM>(rect.lo - offset, rect.hi - offset));
+      auto run = std::min(contiguous_extent(rect, out_strides),
+                          contiguous_extent(rect, element_strides<VAL, DIM>(in)));
+      pieces.push_back(ConcatenatePiece<VAL, DIM>{in, rect, offset, run});
+    }
+
+    ConcatenateImplBody<KIND, CODE, DIM>{}(out, pieces);
+  }
+};
+
+template <VariantKind KIND>
+static void concatenate_template(TaskContext& context)
+{
+  auto& inputs  = context.inputs();
+  auto& outputs = context.outputs();
+  auto& scalars = context.scalars();
+
+  ConcatenateArgs args{
+    outputs[0], inputs, scalars[0].value<int32_t>(), scalars[1].values<int64_t>()};
+  double_dispatch(args.out.dim(), args.out.code(), ConcatenateImpl<KIND>{}, args);
+}
+
+}  // namespace cunumeric
@@ -16,12 +16,87 @@
 
 #include "cunumeric/unary/unary_op.h"
 #include "cunumeric/unary/unary_op_template.inl"
+#include "cunumeric/unary/vector_math.h"
 
 namespace cunumeric {
 
 using namespace Legion;
 using namespace legate;
 
+// Unary operations with vectorized kernels for dense inputs
+template <UnaryOpCode OP_CODE>
+struct VectorMathFunction {
+  static constexpr bool valid = false;
+};
+
+template <>
+struct VectorMathFunction<UnaryOpCode::EXP> {
+  static constexpr bool valid                     = true;
+  static constexpr vector_math::Function function = vector_math::Function::EXP;
+};
+
+template <>
+struct VectorMathFunction<UnaryOpCode::LOG> {
+  static constexpr bool valid                     = true;
+  static constexpr vector_math::Function function = vector_math::Function::LOG;
+};
+
+template <>
+struct VectorMathFunction<UnaryOpCode::SIN> {
+  static constexpr bool valid                     = true;
+  static constexpr vector_math::Function function = vector_math::Function::SIN;
+};
+
+template <>
+struct VectorMathFunction<UnaryOpCode::COS> {
+  static constexpr bool valid                     = true;
+  static constexpr vector_math::Function function = vector_math::Function::COS;
+};
+
+template <>
+struct VectorMathFunction<UnaryOpCode::TANH> {
+  static constexpr bool valid                     = true;
+  static constexpr vector_math::Function function = vector_math::Function::TANH;
+};
+
+template <UnaryOpCode OP_CODE, LegateTypeCode CODE>
+constexpr bool use_vector_math =
+  VectorMathFunction<OP_CODE>::valid &&
+  (CODE == LegateTypeCode::HALF_LT || CODE == LegateTypeCode::FLOAT_LT ||
+   (CODE == LegateTypeCode::DOUBLE_LT && vector_math::VECTORIZE_DOUBLE));
+
+template <vector_math::Function FUNC, typename T>
+static void vector_unary_op(T* out, const T* in, size_t volume)
+{
+  const bool fast = vector_math::use_fast_math();
+#pragma omp parallel for schedule(static)
+  for (size_t lo = 0; lo < volume; lo += vector_math::BLOCK_SIZE) {
+    const size_t n = std::min(vector_math::BLOCK_SIZE, volume - lo);
+    if (fast)
+      vector_math::apply_block<FUNC, true>(out + lo, in + lo, n);
+    else
+      vector_math::apply_block<FUNC, false>(out + lo, in + lo, n);
+  }
+}
+
+// Half-precision values are computed in float, one block at a time
+template <vector_math::Function FUNC>
+static void vector_unary_op(__half* out, const __half* in, size_t volume)
+{
+  const bool fast = vector_math::use_fast_math();
+#pragma omp parallel for schedule(static)
+  for (size_t lo = 0; lo < volume; lo += vector_math::BLOCK_SIZE) {
+    const size_t n = std::min(vector_math::BLOCK_SIZE, volume - lo);
+    float buffer[vector_math::BLOCK_SIZE];
+    for (size_t idx = 0; idx < n; ++idx) buffer[idx] = static_cast<float>(in[lo + idx]);
+    if (fast)
+      vector_math::apply_block<FUNC, true>(buffer, buffer, n);
+    else
+      vector_math::apply_block<FUNC, false>(buffer, buffer, n);
+    for (size_t idx = 0; idx < n; ++idx) out[lo + idx] = __half{buffer[idx]};
+  }
+}
+
 template <UnaryOpCode OP_CODE, LegateTypeCode CODE, int DIM>
 struct UnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
   using OP  = UnaryOp<OP_CODE, CODE>;
@@ -39,6 +114,10 @@ struct UnaryOpImplBody<VariantKind::OMP, OP_CODE, CODE, DIM> {
     if (dense) {
       auto outptr = out.ptr(rect);
       auto inptr  = in.ptr(rect);
+      if constexpr (use_vector_math<OP_CODE, CODE> && std::is_same<RES, ARG>::value) {
+        vector_unary_op<VectorMathFunction<OP_CODE>::function>(outptr, inptr, volume);
+        return;
+      }
 #pragma omp parallel for schedule(static)
       for (size_t idx = 0; idx < volume; ++idx) outptr[idx] = func(inptr[idx]);
     } else {
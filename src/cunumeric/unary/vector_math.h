@@ -0,0 +1,491 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// Transcendental functions over arrays, written as branch-free polynomial kernels that the
+// compiler can vectorize, unlike calls to libm. The reductions and polynomials follow Cephes.
+// There are two accuracy modes, selected with CUNUMERIC_FAST_MATH:
+//  * accurate: within 2 ULP of the correctly rounded result
+//  * fast: shorter polynomials for exp, tanh and double log, within 4 ULP for float and 8 ULP for
+//    double
+// Both modes handle NaN, infinities, signed zeros and subnormals like libm does.
+
+namespace cunumeric {
+namespace vector_math {
+
+// Elements are processed in blocks, so that a block with arguments that the vector kernels can't
+// reduce accurately can fall back to libm without giving up vectorization for the others
+constexpr size_t BLOCK_SIZE = 256;
+
+// The double kernels only beat libm with four lanes and FMA
+#if defined(__AVX2__) && defined(__FMA__)
+constexpr bool VECTORIZE_DOUBLE = true;
+#else
+constexpr bool VECTORIZE_DOUBLE = false;
+#endif
+
+namespace detail {
+
+inline float as_float(int32_t bits)
+{
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+inline int32_t as_int(float value)
+{
+  int32_t result;
+  std::memcpy(&result, &value, sizeof(result));
+  return result;
+}
+
+inline double as_double(int64_t bits)
+{
+  double result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+inline int64_t as_int(double value)
+{
+  int64_t result;
+  std::memcpy(&result, &value, sizeof(result));
+  return result;
+}
+
+// Selects without a branch. The compiler won't speculate floating-point operations that can raise
+// exceptions, so it keeps a ternary over their results as a branch, which stops vectorization.
+inline float select(bool condition, float a, float b)
+{
+  int32_t mask = -static_cast<int32_t>(condition);
+  return as_float((as_int(a) & mask) | (as_int(b) & ~mask));
+}
+
+inline double select(bool condition, double a, double b)
+{
+  int64_t mask = -static_cast<int64_t>(condition);
+  return as_double((as_int(a) & mask) | (as_int(b) & ~mask));
+}
+
+// Predicates on the bit patterns, which tell NaN and negative zeros apart
+inline int32_t magnitude(float x) { return as_int(x) & 0x7fffffff; }
+
+inline int64_t magnitude(double x) { return as_int(x) & 0x7fffffffffffffffLL; }
+
+template <typename T>
+inline bool is_nan(T x)
+{
+  return magnitude(x) > magnitude(std::numeric_limits<T>::infinity());
+}
+
+// True for -0 as well
+template <typename T>
+inline bool is_negative(T x)
+{
+  return as_int(x) < 0;
+}
+
+template <typename T>
+inline bool abs_less(T x, T y)
+{
+  return magnitude(x) < magnitude(y);
+}
+
+template <typename T>
+inline bool abs_greater(T x, T y)
+{
+  return magnitude(x) > magnitude(y);
+}
+
+// Rounds to the nearest integer for |x| < 2^22 (float) or 2^51 (double) without a libm call
+inline float round_int(float x)
+{
+  const float magic = 12582912.0f;  // 1.5 * 2^23
+  return (x + magic) - magic;
+}
+
+inline double round_int(double x)
+{
+  const double magic = 6755399441055744.0;  // 1.5 * 2^52
+  return (x + magic) - magic;
+}
+
+template <bool FAST>
+inline float exp(float x)
+{
+  const float max_arg = 88.72283935546875f;
+  const float min_arg = -103.972084045410f;
+  bool negative       = is_negative(x);
+  float xc            = select(negative & abs_greater(x, -104.0f), -104.0f, x);
+  xc                  = select(!negative & abs_greater(x, 89.0f), 89.0f, xc);
+
+  // x = n * ln(2) + r, with |r| <= ln(2) / 2
+  float n = round_int(xc * 1.44269504088896341f);
+  float r = xc - n * 0.693359375f;
+  r       = r - n * -2.12194440e-4f;
+
+  float p;
+  if constexpr (FAST)
+    p = ((((1.0f / 720.0f * r + 1.0f / 120.0f) * r + 1.0f / 24.0f) * r + 1.0f / 6.0f) * r + 0.5f) *
+          r * r +
+        r + 1.0f;
+  else
+    p = (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r +
+           4.1665795894e-2f) *
+            r +
+          1.6666665459e-1f) *
+           r +
+         5.0000001201e-1f) *
+          r * r +
+        r + 1.0f;
+
+  // Scale by 2^n in two steps, so that results in the subnormal range come out right
+  int32_t ni = static_cast<int32_t>(n);
+  int32_t n1 = ni >> 1;
+  int32_t n2 = ni - n1;
+  float y    = p * as_float((n1 + 127) << 23) * as_float((n2 + 127) << 23);
+
+  y = select(!negative & abs_greater(x, max_arg), std::numeric_limits<float>::infinity(), y);
+  y = select(negative & abs_greater(x, min_arg), 0.0f, y);
+  return select(is_nan(x), x, y);
+}
+
+template <bool FAST>
+inline double exp(double x)
+{
+  const double max_arg = 709.782712893383973096;
+  const double min_arg = -745.1332191019411;
+  bool negative        = is_negative(x);
+  double xc            = select(negative & abs_greater(x, -746.0), -746.0, x);
+  xc                   = select(!negative & abs_greater(x, 710.0), 710.0, xc);
+
+  double n = round_int(xc * 1.4426950408889634073599);
+  double r = xc - n * 6.93145751953125e-1;
+  r        = r - n * 1.42860682030941723212e-6;
+
+  double p;
+  if constexpr (FAST) {
+    // Taylor polynomial of degree 12, which avoids the division of the Pade approximation
+    p = 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r * r + r + 1.0;
+  } else {
+    // Pade approximation: exp(r) = 1 + 2 r P(r^2) / (Q(r^2) - r P(r^2))
+    double rr = r * r;
+    double px =
+      r * ((1.26177193074810590878e-4 * rr + 3.02994407707441961300e-2) * rr +
+           9.99999999999999999910e-1);
+    double qx = ((3.00198505138664455042e-6 * rr + 2.52448340349684104192e-3) * rr +
+                 2.27265548208155028766e-1) *
+                  rr +
+                2.00000000000000000009e0;
+    p         = 1.0 + 2.0 * px / (qx - px);
+  }
+
+  // 32-bit integers, as conversions between doubles and 64-bit integers don't vectorize before
+  // AVX-512
+  int32_t ni = static_cast<int32_t>(n);
+  int32_t n1 = ni >> 1;
+  int32_t n2 = ni - n1;
+  double y   = p * as_double(static_cast<int64_t>(n1 + 1023) << 52) *
+             as_double(static_cast<int64_t>(n2 + 1023) << 52);
+
+  y = select(!negative & abs_greater(x, max_arg), std::numeric_limits<double>::infinity(), y);
+  y = select(negative & abs_greater(x, min_arg), 0.0, y);
+  return select(is_nan(x), x, y);
+}
+
+template <bool FAST>
+inline float log(float x)
+{
+  // Bring subnormal inputs into the normal range first
+  bool subnormal = abs_less(x, std::numeric_limits<float>::min());
+  float xs       = select(subnormal, x * 8388608.0f, x);  // 2^23
+  int32_t bits   = as_int(xs);
+
+  // x = m * 2^e, with m in [sqrt(1/2), sqrt(2))
+  int32_t e  = ((bits >> 23) & 0xff) - 126;
+  float m    = as_float((bits & 0x007fffff) | 0x3f000000);  // in [0.5, 1)
+  bool small = abs_less(m, 0.707106781186547524f);
+  float ef   = static_cast<float>(e - small - 23 * subnormal);
+  float f    = select(small, m + m, m) - 1.0f;
+  float z    = f * f;
+
+  // The float kernel is cheap enough that the fast mode uses it too
+  float p = ((((((((7.0376836292e-2f * f - 1.1514610310e-1f) * f + 1.1676998740e-1f) * f -
+                  1.2420140846e-1f) *
+                   f +
+                 1.4249322787e-1f) *
+                  f -
+                1.6668057665e-1f) *
+                 f +
+               2.0000714765e-1f) *
+                f -
+              2.4999993993e-1f) *
+               f +
+             3.3333331174e-1f);
+  float y = p * f * z + ef * -2.12194440e-4f - 0.5f * z;
+  y       = f + y + ef * 0.693359375f;
+
+  y = select(as_int(x) == as_int(std::numeric_limits<float>::infinity()), x, y);
+  y = select(is_negative(x), std::numeric_limits<float>::quiet_NaN(), y);
+  y = select(magnitude(x) == 0, -std::numeric_limits<float>::infinity(), y);
+  return select(is_nan(x), x, y);
+}
+
+template <bool FAST>
+inline double log(double x)
+{
+  bool subnormal = abs_less(x, std::numeric_limits<double>::min());
+  double xs      = select(subnormal, x * 4503599627370496.0, x);  // 2^52
+  int64_t bits   = as_int(xs);
+
+  int32_t e  = static_cast<int32_t>((bits >> 52) & 0x7ff) - 1022;
+  double m   = as_double((bits & 0x000fffffffffffffLL) | 0x3fe0000000000000LL);
+  bool small = abs_less(m, 0.707106781186547524);
+  double ed  = static_cast<double>(e - small - 52 * subnormal);
+  double f   = select(small, m + m, m) - 1.0;
+  double z   = f * f;
+
+  double y;
+  if constexpr (FAST) {
+    // log(1 + f) = 2 atanh(s), with s = f / (2 + f) and |s| <= 0.172
+    double s  = f / (2.0 + f);
+    double s2 = s * s;
+    double t  = 1.0 / 17.0;
+    t         = t * s2 + 1.0 / 15.0;
+    t         = t * s2 + 1.0 / 13.0;
+    t         = t * s2 + 1.0 / 11.0;
+    t         = t * s2 + 1.0 / 9.0;
+    t         = t * s2 + 1.0 / 7.0;
+    t         = t * s2 + 1.0 / 5.0;
+    t         = t * s2 + 1.0 / 3.0;
+    // 2 s = f - s f, which keeps the rounding error of the leading term small
+    double hf = 0.5 * z;
+    y         = s * (hf + s2 * 2.0 * t) + ed * 1.42860682030941723212e-6 - hf;
+    y         = f + y + ed * 6.93145751953125e-1;
+  } else {
+    double p = ((((1.01875663804580931796e-4 * f + 4.97494994976747001425e-1) * f +
+                  4.70579119878881725854e0) *
+                   f +
+                 1.44989225341610930846e1) *
+                  f +
+                1.79368678507819816313e1) *
+                 f +
+               7.70838733755885391666e0;
+    double q = ((((f + 1.12873587189167450590e1) * f + 4.52279145837532221105e1) * f +
+                 8.29875266912776603211e1) *
+                  f +
+                7.11544750618563894466e1) *
+                 f +
+               2.31251620126765340583e1;
+    y        = f * (z * p / q) - ed * 2.121944400546905827679e-4 - 0.5 * z;
+    y        = f + y + ed * 0.693359375;
+  }
+
+  y = select(as_int(x) == as_int(std::numeric_limits<double>::infinity()), x, y);
+  y = select(is_negative(x), std::numeric_limits<double>::quiet_NaN(), y);
+  y = select(magnitude(x) == 0, -std::numeric_limits<double>::infinity(), y);
+  return select(is_nan(x), x, y);
+}
+
+// Largest arguments for which the three-part reduction by pi/4 stays accurate
+constexpr float MAX_TRIG_ARG_F32  = 8192.0f;
+constexpr double MAX_TRIG_ARG_F64 = 1.073741824e9;
+
+// sin (COS = false) or cos (COS = true) for |x| <= MAX_TRIG_ARG_F32. The polynomials are already
+// as short as the accuracy of the reduction allows, so both modes use them.
+template <bool COS>
+inline float sincos(float x)
+{
+  float ax = std::fabs(x);
+  // x = j * pi / 4 + r, with j even and |r| <= pi / 4. The reduction is done in double, as the
+  // three-part reduction in float loses too much accuracy for results close to zero.
+  int32_t j = static_cast<int32_t>(ax * 1.27323954473516f);
+  j += j & 1;
+  double jd = static_cast<double>(j);
+  double rd = ((static_cast<double>(ax) - jd * 7.85398125648498535156e-1) -
+               jd * 3.77489470793079817668e-8) -
+              jd * 2.69515142907905952645e-15;
+  float r   = static_cast<float>(rd);
+  if constexpr (COS) j += 2;
+  float z = r * r;
+
+  float s = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+  float c = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) *
+              z * z -
+            0.5f * z + 1.0f;
+
+  float y   = select((j & 2) != 0, c, s);
+  bool flip = (j & 4) != 0;
+  // sin is odd, which includes keeping the sign of zeros
+  if constexpr (!COS) flip = flip != is_negative(x);
+  return select(flip, -y, y);
+}
+
+template <bool COS>
+inline double sincos(double x)
+{
+  double ax = std::fabs(x);
+  int32_t j = static_cast<int32_t>(ax * 1.27323954473516268615);
+  j += j & 1;
+  double jf = static_cast<double>(j);
+  double r  = ((ax - jf * 7.85398125648498535156e-1) - jf * 3.77489470793079817668e-8) -
+             jf * 2.69515142907905952645e-15;
+  if constexpr (COS) j += 2;
+  double z = r * r;
+
+  double s = ((((((1.58962301576546568060e-10 * z - 2.50507477628578072866e-8) * z +
+                  2.75573136213857245213e-6) *
+                   z -
+                 1.98412698295895385996e-4) *
+                  z +
+                8.33333333332211858878e-3) *
+                 z -
+               1.66666666666666307295e-1) *
+                z * r +
+              r);
+  double c = ((((((-1.13585365213876817300e-11 * z + 2.08757008419747316778e-9) * z -
+                  2.75573141792967388112e-7) *
+                   z +
+                 2.48015872888517045348e-5) *
+                  z -
+                1.38888888888730564116e-3) *
+                 z +
+               4.16666666666665929218e-2) *
+                z * z -
+              0.5 * z + 1.0);
+
+  double y  = select((j & 2) != 0, c, s);
+  bool flip = (j & 4) != 0;
+  if constexpr (!COS) flip = flip != is_negative(x);
+  return select(flip, -y, y);
+}
+
+template <bool FAST>
+inline float tanh(float x)
+{
+  float ax = std::fabs(x);
+  float z  = x * x;
+  float small =
+    ((((-5.70498872745e-3f * z + 2.06390887954e-2f) * z - 5.37397155531e-2f) * z +
+      1.33314422036e-1f) *
+       z -
+     3.33332819422e-1f) *
+      z * x +
+    x;
+  // tanh(|x|) = 1 - 2 / (exp(2 |x|) + 1), which saturates to 1 as exp overflows
+  float large = 1.0f - 2.0f / (exp<FAST>(ax + ax) + 1.0f);
+  large       = select(is_negative(x), -large, large);
+  float y     = select(abs_less(x, 0.625f), small, large);
+  // Zeros keep their sign
+  return select(is_nan(x) | (magnitude(x) == 0), x, y);
+}
+
+template <bool FAST>
+inline double tanh(double x)
+{
+  double ax = std::fabs(x);
+  double z  = x * x;
+  double p  = (-9.64399179425052238628e-1 * z - 9.92877231001918586564e1) * z -
+             1.61468768441708447952e3;
+  double q = ((z + 1.12811678491632931402e2) * z + 2.23548839060100448583e3) * z +
+             4.84406305325125486048e3;
+  double small = x + x * z * p / q;
+  double large = 1.0 - 2.0 / (exp<FAST>(ax + ax) + 1.0);
+  large        = select(is_negative(x), -large, large);
+  double y     = select(abs_less(x, 0.625), small, large);
+  return select(is_nan(x) | (magnitude(x) == 0), x, y);
+}
+
+}  // namespace detail
+
+enum class Function : int {
+  EXP,
+  LOG,
+  SIN,
+  COS,
+  TANH,
+};
+
+template <Function FUNC, bool FAST, typename T>
+inline T apply(T x)
+{
+  if constexpr (FUNC == Function::EXP) return detail::exp<FAST>(x);
+  if constexpr (FUNC == Function::LOG) return detail::log<FAST>(x);
+  if constexpr (FUNC == Function::SIN) return detail::sincos<false>(x);
+  if constexpr (FUNC == Function::COS) return detail::sincos<true>(x);
+  if constexpr (FUNC == Function::TANH) return detail::tanh<FAST>(x);
+}
+
+template <Function FUNC, typename T>
+inline T apply_libm(T x)
+{
+  if constexpr (FUNC == Function::EXP) return std::exp(x);
+  if constexpr (FUNC == Function::LOG) return std::log(x);
+  if constexpr (FUNC == Function::SIN) return std::sin(x);
+  if constexpr (FUNC == Function::COS) return std::cos(x);
+  if constexpr (FUNC == Function::TANH) return std::tanh(x);
+}
+
+// Applies the function to a block of at most BLOCK_SIZE elements
+template <Function FUNC, bool FAST, typename T>
+void apply_block(T* out, const T* in, size_t n)
+{
+  if constexpr (FUNC == Function::SIN || FUNC == Function::COS) {
+    // Arguments that are too large, infinite or NaN go to libm
+    const T max_arg = sizeof(T) == 4 ? detail::MAX_TRIG_ARG_F32 : detail::MAX_TRIG_ARG_F64;
+    int32_t num_out_of_range = 0;
+#pragma omp simd reduction(+ : num_out_of_range)
+    for (size_t idx = 0; idx < n; ++idx) num_out_of_range += detail::abs_greater(in[idx], max_arg);
+    if (num_out_of_range > 0) {
+      for (size_t idx = 0; idx < n; ++idx) out[idx] = apply_libm<FUNC>(in[idx]);
+      return;
+    }
+  }
+#pragma omp simd
+  for (size_t idx = 0; idx < n; ++idx) out[idx] = apply<FUNC, FAST>(in[idx]);
+}
+
+// Returns true when CUNUMERIC_FAST_MATH selects the fast mode
+inline bool use_fast_math()
+{
+  static const bool fast_math = [] {
+    const char* value = getenv("CUNUMERIC_FAST_MATH");
+    return value != nullptr && atoi(value) > 0;
+  }();
+  return fast_math;
+}
+
+}  // namespace vector_math
+}  // namespace cunumeric
@@ -0,0 +1,123 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "cunumeric/utilities/scratch_arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+namespace cunumeric {
+
+namespace  // unnamed
+{
+size_t align_up(size_t bytes)
+{
+  return (bytes + ScratchArena::ALIGNMENT - 1) / ScratchArena::ALIGNMENT * ScratchArena::ALIGNMENT;
+}
+
+size_t arena_limit()
+{
+  static const size_t limit = [] {
+    const char* value = getenv("CUNUMERIC_SCRATCH_ARENA_LIMIT");
+    size_t mib        = value != nullptr ? strtoull(value, nullptr, 10) : 16;
+    return mib << 20;
+  }();
+  return limit;
+}
+
+}  // namespace
+
+/*static*/ ScratchArena& ScratchArena::get()
+{
+  static thread_local ScratchArena arena;
+  return arena;
+}
+
+ScratchArena::~ScratchArena()
+{
+  for (auto ptr : overflow) free(ptr);
+  free(base);
+}
+
+void* ScratchArena::allocate(size_t bytes)
+{
+  assert(depth > 0);
+  size_t lo = align_up(offset);
+  size_t hi = lo + align_up(std::max<size_t>(bytes, 1));
+
+  // The offset keeps growing past the capacity, so that the arena knows how much to grow by
+  last_offset = offset;
+  offset      = hi;
+  peak        = std::max(peak, hi);
+  if (hi <= capacity)
+    last_ptr = base + lo;
+  else {
+    last_ptr = aligned_alloc(ALIGNMENT, hi - lo);
+    overflow.push_back(last_ptr);
+  }
+  return last_ptr;
+}
+
+void ScratchArena::deallocate(void* ptr)
+{
+  if (ptr == nullptr) return;
+  auto finder = std::find(overflow.begin(), overflow.end(), ptr);
+  if (finder != overflow.end()) {
+    free(ptr);
+    overflow.erase(finder);
+  }
+  if (ptr == last_ptr) {
+    offset   = last_offset;
+    last_ptr = nullptr;
+  }
+}
+
+size_t ScratchArena::enter()
+{
+  ++depth;
+  return offset;
+}
+
+void ScratchArena::leave(size_t mark)
+{
+  assert(depth > 0);
+  offset   = mark;
+  last_ptr = nullptr;
+  if (--depth > 0) return;
+
+  for (auto ptr : overflow) free(ptr);
+  overflow.clear();
+
+  auto demand   = std::min(peak, align_up(arena_limit()));
+  recent_peak   = std::max(recent_peak, demand);
+  peak          = 0;
+  size_t target = capacity;
+  if (demand > capacity)
+    target = demand;
+  else if (++scopes == TRIM_INTERVAL) {
+    // Release what the last scopes left unused, unless it's a small part of the arena
+    if (recent_peak < capacity / 2) target = recent_peak;
+    recent_peak = 0;
+    scopes      = 0;
+  }
+  if (target == capacity) return;
+  free(base);
+  base     = target > 0 ? static_cast<char*>(aligned_alloc(ALIGNMENT, target)) : nullptr;
+  capacity = base != nullptr ? target : 0;
+}
+
+}  // namespace cunumeric
@@ -0,0 +1,101 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace cunumeric {
+
+// A bump allocator for the temporaries of task bodies, so that tasks that run repeatedly with
+// the same sizes stop going to the system allocator and faulting in fresh pages. There is one
+// arena per thread that executes tasks, which amounts to one per processor. Task bodies borrow
+// memory through a ScratchScope, and everything they borrowed is returned when the outermost
+// scope ends. An arena that ran out of space grows to the peak demand at that point, up to the
+// high-water mark set with CUNUMERIC_SCRATCH_ARENA_LIMIT (in MiB, 16 by default). Allocations
+// beyond it come from the system allocator and are freed with the scope. The arena is system
+// memory that Legion doesn't account for, so it shrinks back to the recent peak demand once it
+// has been mostly idle for TRIM_INTERVAL scopes. Temporaries that are too large to keep around
+// or that belong in a particular memory should use legate's buffers instead.
+//
+// Arenas aren't thread-safe, so memory must be borrowed outside of OpenMP parallel regions. A
+// task must not block or yield to the runtime inside a ScratchScope, e.g. by waiting on a
+// future, as another task could then run on the same thread and reuse the memory it borrowed.
+class ScratchArena {
+ public:
+  static constexpr size_t ALIGNMENT = 64;
+  // Number of outermost scopes after which the arena gives back the space they didn't use
+  static constexpr size_t TRIM_INTERVAL = 64;
+
+ public:
+  ScratchArena() = default;
+  ~ScratchArena();
+
+ private:
+  ScratchArena(const ScratchArena&)            = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+ public:
+  // Returns the arena of the calling thread
+  static ScratchArena& get();
+
+ public:
+  void* allocate(size_t bytes);
+  // Only the most recent allocation is given back right away, which covers temporaries that are
+  // allocated and freed in a stack-like order, such as thrust's. Others wait for the scope to end.
+  void deallocate(void* ptr);
+
+ private:
+  friend class ScratchScope;
+  size_t enter();
+  void leave(size_t mark);
+
+ private:
+  char* base{nullptr};
+  size_t capacity{0};
+  size_t offset{0};
+  size_t peak{0};
+  size_t recent_peak{0};
+  size_t scopes{0};
+  size_t depth{0};
+  void* last_ptr{nullptr};
+  size_t last_offset{0};
+  std::vector<void*> overflow;
+};
+
+class ScratchScope {
+ public:
+  ScratchScope() : arena(ScratchArena::get()), mark(arena.enter()) {}
+  ~ScratchScope() { arena.leave(mark); }
+
+ private:
+  ScratchScope(const ScratchScope&)            = delete;
+  ScratchScope& operator=(const ScratchScope&) = delete;
+
+ public:
+  template <typename VAL>
+  VAL* allocate(size_t size)
+  {
+    return static_cast<VAL*>(arena.allocate(size * sizeof(VAL)));
+  }
+
+ private:
+  ScratchArena& arena;
+  size_t mark;
+};
+
+}  // namespace cunumeric
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "legate.h"
+#include "cunumeric/utilities/scratch_arena.h"
 
 namespace cunumeric {
 
@@ -34,4 +35,18 @@ class ThrustAllocator : public legate::ScopedAllocator {
   void deallocate(char* ptr, size_t n) { ScopedAllocator::deallocate(ptr); }
 };
 
+// Borrows thrust's temporaries on the host from the scratch arena of the calling thread, which
+// must be inside a ScratchScope
+class ScratchAllocator {
+ public:
+  using value_type = char;
+
+  char* allocate(size_t num_bytes)
+  {
+    return static_cast<char*>(ScratchArena::get().allocate(num_bytes));
+  }
+
+  void deallocate(char* ptr, size_t n) { ScratchArena::get().deallocate(ptr); }
+};
+
 }  // namespace cunumeric
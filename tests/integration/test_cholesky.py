@@ -13,13 +13,19 @@
 # limitations under the License.
 #
 
+import importlib
+
 import numpy as np
 import pytest
+from legate.core.shape import Shape
 
 import cunumeric as num
+from cunumeric.runtime import runtime
 
 SIZES = [8, 9, 255, 512]
 
+cholesky_module = importlib.import_module("cunumeric.linalg.cholesky")
+
 
 def test_diagonal():
     a = num.eye(10) * 10.0
@@ -51,6 +57,45 @@ def test_complex(n):
     assert num.allclose(c, c_np)
 
 
+@pytest.fixture
+def sixteen_procs(monkeypatch):
+    # Test mode always picks twice as many tiles as processors
+    monkeypatch.setattr(runtime.args, "test_mode", False)
+    monkeypatch.setattr(runtime, "num_procs", 16)
+
+
+def pick_tiles(monkeypatch, throughput):
+    def measure(runtime, dtype, tile_size):
+        if throughput is None:
+            raise AssertionError("GEMM throughput measured without opt-in")
+        return throughput[tile_size]
+
+    monkeypatch.setattr(cholesky_module, "measure_gemm_throughput", measure)
+    color_shape = cholesky_module.choose_color_shape(
+        runtime, Shape((16384, 16384)), np.dtype(np.float64)
+    )
+    return tuple(color_shape)
+
+
+def test_color_shape_default(monkeypatch, sixteen_procs):
+    monkeypatch.setattr(runtime.args, "benchmark_gemm", False)
+    assert pick_tiles(monkeypatch, None) == (16, 16)
+
+
+@pytest.mark.parametrize(
+    "throughput, num_tiles",
+    (
+        ({256: 1e12, 512: 1e11, 1024: 1e10}, 64),
+        ({256: 1e9, 512: 1e10, 1024: 1e12}, 16),
+    ),
+)
+def test_color_shape_benchmark(
+    monkeypatch, sixteen_procs, throughput, num_tiles
+):
+    monkeypatch.setattr(runtime.args, "benchmark_gemm", True)
+    assert pick_tiles(monkeypatch, throughput) == (num_tiles, num_tiles)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -121,6 +121,45 @@ def test_column_dstack(size, a):
     run_test(tuple(a), "dstack", size)
 
 
+@pytest.mark.parametrize("axis", (0, 1, -1))
+def test_concatenate_many(axis):
+    # The small inputs are copied by a single task, the large one on its own
+    sizes = [idx % 4 + 1 for idx in range(40)]
+    sizes.insert(20, 50000)
+    arrays = []
+    for size in sizes:
+        shape = [7, 7, 3]
+        shape[axis] = size
+        arrays.append(np.random.randint(0, 100, size=shape))
+    arrays[3] = arrays[3].astype(np.int8)
+    a = np.concatenate(arrays, axis=axis)
+    b = num.concatenate([num.array(arr) for arr in arrays], axis=axis)
+    assert np.array_equal(a, b)
+
+
+def test_concatenate_broadcast_limit(monkeypatch):
+    # Only the inputs that fit in the limit together are copied by a single
+    # task, and the others are copied one by one
+    arrays = [
+        np.full((idx % 3 + 1, 50), idx, dtype=np.int64) for idx in range(30)
+    ]
+    monkeypatch.setattr(
+        "cunumeric.module._MAX_CONCATENATE_BROADCAST_BYTES", 10 * 50 * 8
+    )
+    a = np.concatenate(arrays)
+    b = num.concatenate([num.array(arr) for arr in arrays])
+    assert np.array_equal(a, b)
+
+
+def test_vstack_views():
+    def views(x):
+        return [x[idx::5, ::-3] for idx in range(5)] + [x[:3, :10]]
+
+    a = np.arange(600).reshape(20, 30)
+    b = num.array(a)
+    assert np.array_equal(np.vstack(views(a)), num.vstack(views(b)))
+
+
 if __name__ == "__main__":
     import sys
 
@@ -0,0 +1,120 @@
+# Copyright 2021-2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import numpy as np
+import pytest
+
+import cunumeric as num
+from cunumeric.runtime import (
+    DEFAULT_EAGER_SCALES,
+    EAGER_CALIBRATION_SCALES,
+    runtime,
+)
+
+BASE = 16
+N = 8
+
+
+@pytest.fixture
+def thresholds(monkeypatch):
+    # Test mode turns off eager execution, so turn it back on and use
+    # volumes small enough that the arrays below straddle them
+    monkeypatch.setattr(runtime.args, "test_mode", False)
+    monkeypatch.setattr(runtime, "max_eager_volume", BASE)
+    monkeypatch.setattr(runtime, "eager_thresholds", {})
+    return runtime.eager_thresholds
+
+
+def outer(thresholds, volume):
+    # The inputs fit in the base volume, but the result does not
+    a = num.array(np.arange(N, dtype=np.float64).reshape(N, 1))
+    b = num.array(np.arange(N, 0, -1, dtype=np.float64).reshape(1, N))
+    assert runtime.is_eager_array(a._thunk)
+    assert runtime.is_eager_array(b._thunk)
+    thresholds["contract"] = volume
+    return num.matmul(a, b)
+
+
+def test_default_scales():
+    for op in ("contract", "sort"):
+        assert runtime.eager_threshold(op) >= runtime.eager_threshold()
+    assert runtime.eager_threshold("unknown") == runtime.eager_threshold()
+
+
+@pytest.mark.parametrize("volume", (BASE, N * N))
+def test_contract(thresholds, volume):
+    c = outer(thresholds, volume)
+    assert runtime.is_eager_array(c._thunk) == (volume >= N * N)
+    an = np.arange(N, dtype=np.float64).reshape(N, 1)
+    bn = np.arange(N, 0, -1, dtype=np.float64).reshape(1, N)
+    assert np.array_equal(c, np.matmul(an, bn))
+
+
+@pytest.mark.parametrize("volume", (BASE, N * N))
+def test_sort(thresholds, volume):
+    c = outer(thresholds, N * N)
+    assert runtime.is_eager_array(c._thunk)
+    thresholds["sort"] = volume
+    out = num.sort(c)
+    assert runtime.is_eager_array(out._thunk) == (volume >= N * N)
+    assert np.array_equal(out, np.sort(np.asarray(c)))
+
+
+@pytest.fixture
+def calibration(monkeypatch, tmp_path):
+    monkeypatch.setattr(runtime.args, "test_mode", False)
+    monkeypatch.setattr(runtime, "max_eager_volume", BASE)
+    monkeypatch.setattr(runtime, "num_nodes", 1)
+    path = tmp_path / "eager_scales.json"
+    monkeypatch.setenv("CUNUMERIC_EAGER_CACHE", str(path))
+    return path
+
+
+@pytest.mark.parametrize("op", sorted(DEFAULT_EAGER_SCALES))
+def test_calibrate(calibration, op):
+    assert runtime._calibrate_eager_scale(op) in EAGER_CALIBRATION_SCALES
+
+
+def test_calibration_cache(monkeypatch, calibration):
+    calibrated = []
+
+    def calibrate(op):
+        calibrated.append(op)
+        return 2
+
+    monkeypatch.setattr(runtime, "_calibrate_eager_scale", calibrate)
+    expected = {op: 2 for op in DEFAULT_EAGER_SCALES}
+    assert runtime._eager_scales() == expected
+    assert sorted(calibrated) == sorted(DEFAULT_EAGER_SCALES)
+    assert calibration.exists()
+
+    # The second lookup reads the cache instead of measuring again
+    calibrated.clear()
+    assert runtime._eager_scales() == expected
+    assert calibrated == []
+
+
+def test_calibration_disabled(monkeypatch, calibration):
+    def calibrate(op):
+        raise AssertionError("calibrated with the cache disabled")
+
+    monkeypatch.setattr(runtime, "_calibrate_eager_scale", calibrate)
+    monkeypatch.setenv("CUNUMERIC_EAGER_CACHE", "")
+    assert runtime._eager_scales() == DEFAULT_EAGER_SCALES
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -0,0 +1,72 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SIZES = [1, 8, 9, 100]
+
+
+def make_hermitian(n, complex):
+    a = num.random.rand(n, n)
+    if complex:
+        a = a + num.random.rand(n, n) * 1.0j
+    return a + a.T.conj()
+
+
+@pytest.mark.parametrize("n", SIZES)
+@pytest.mark.parametrize("complex", [False, True])
+@pytest.mark.parametrize("UPLO", ["L", "U"])
+def test_eigh(n, complex, UPLO):
+    a = make_hermitian(n, complex)
+    w, v = num.linalg.eigh(a, UPLO=UPLO)
+    w_np = np.linalg.eigvalsh(a.__array__(), UPLO=UPLO)
+    assert w.dtype == w_np.dtype
+    assert num.allclose(w, w_np)
+    assert num.allclose(a @ v, v * w)
+    assert num.allclose(v.T.conj() @ v, num.eye(n))
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_eigvalsh(n):
+    a = make_hermitian(n, False)
+    w = num.linalg.eigvalsh(a)
+    w_np = np.linalg.eigvalsh(a.__array__())
+    assert num.allclose(w, w_np)
+
+
+def test_only_triangle_used():
+    a = make_hermitian(10, False)
+    lower = num.tril(a)
+    upper = num.triu(a)
+    assert num.allclose(
+        num.linalg.eigvalsh(lower, UPLO="L"),
+        num.linalg.eigvalsh(upper, UPLO="U"),
+    )
+
+
+def test_invalid():
+    with pytest.raises(num.linalg.LinAlgError):
+        num.linalg.eigh(num.ones((3, 4)))
+    with pytest.raises(ValueError):
+        num.linalg.eigh(num.ones((3, 3)), UPLO="X")
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
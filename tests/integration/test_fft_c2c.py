@@ -179,6 +179,15 @@ def test_3d():
     check_3d_c2c(N=(9, 10, 11), dtype=np.float32)
 
 
+def test_plan_cache_eviction():
+    # Tests keep two cuFFT plans per transform type, so cycling through more
+    # sizes evicts plans and then creates them again
+    sizes = (64, 100, 127, 64, 100, 127, 64)
+    for N in sizes:
+        Z = np.random.rand(N) + np.random.rand(N) * 1j
+        assert allclose(np.fft.fft(Z), num.fft.fft(num.array(Z)))
+
+
 if __name__ == "__main__":
     import sys
 
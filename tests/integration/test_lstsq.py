@@ -0,0 +1,80 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SHAPES = [(8, 8), (1000, 10), (255, 64), (3, 9)]
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+@pytest.mark.parametrize("ndim", [1, 2])
+def test_lstsq(shape, ndim):
+    m, _ = shape
+    a = num.random.rand(*shape)
+    b = num.random.rand(m) if ndim == 1 else num.random.rand(m, 3)
+    x, res, rank, s = num.linalg.lstsq(a, b)
+    x_np, res_np, rank_np, s_np = np.linalg.lstsq(
+        a.__array__(), b.__array__(), rcond=None
+    )
+    assert x.shape == x_np.shape
+    assert num.allclose(x, x_np)
+    assert res.shape == res_np.shape
+    assert num.allclose(res, res_np)
+    assert rank == rank_np
+    assert num.allclose(s, s_np)
+
+
+def test_complex():
+    a = num.random.rand(100, 4) + num.random.rand(100, 4) * 1.0j
+    b = num.random.rand(100) + num.random.rand(100) * 1.0j
+    x, _, _, _ = num.linalg.lstsq(a, b)
+    x_np, _, _, _ = np.linalg.lstsq(a.__array__(), b.__array__(), rcond=None)
+    assert num.allclose(x, x_np)
+
+
+@pytest.mark.parametrize("shape", [(20, 8), (4000, 5)])
+def test_many_rhs(shape):
+    # The first shape has too few rows for the augmented matrix [a | b] to
+    # be tall, so the solver forms q instead
+    m, _ = shape
+    a = num.random.rand(*shape)
+    b = num.random.rand(m, 15)
+    x, res, _, _ = num.linalg.lstsq(a, b)
+    x_np, res_np, _, _ = np.linalg.lstsq(
+        a.__array__(), b.__array__(), rcond=None
+    )
+    assert num.allclose(x, x_np)
+    assert num.allclose(res, res_np)
+
+
+def test_rank_deficient():
+    a = num.ones((10, 3))
+    b = num.arange(10.0)
+    x, res, rank, _ = num.linalg.lstsq(a, b)
+    x_np, res_np, rank_np, _ = np.linalg.lstsq(
+        a.__array__(), b.__array__(), rcond=None
+    )
+    assert rank == rank_np == 1
+    assert res.shape == res_np.shape == (0,)
+    assert num.allclose(x, x_np)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -13,7 +13,9 @@
 # limitations under the License.
 #
 
+import numpy as np
 import pytest
+from cunumeric.linalg import summa
 from cunumeric.utils import matmul_modes
 from test_tools.contractions import (
     check_default,
@@ -22,6 +24,7 @@ from test_tools.contractions import (
     check_types,
 )
 
+import cunumeric as num
 from legate.core import LEGATE_MAX_DIM
 
 
@@ -41,6 +44,116 @@ def test(a_ndim, b_ndim):
         check_types(name, modes, operation)
 
 
+# Sizes that don't divide evenly into tiles and panels
+@pytest.mark.parametrize("m, k, n", [(1, 1, 1), (37, 53, 29), (130, 7, 65)])
+@pytest.mark.parametrize("transpose", [False, True])
+@pytest.mark.parametrize("use_summa", [False, True])
+def test_tiled(monkeypatch, m, k, n, transpose, use_summa):
+    if use_summa:
+        monkeypatch.setattr(summa, "MIN_SUMMA_MATRIX_SIZE", 1)
+        monkeypatch.setattr(summa, "MIN_SUMMA_PROCS", 1)
+    a_np = np.random.rand(m, k)
+    b_np = np.random.rand(k, n)
+    if transpose:
+        # Operands that are views of transposed arrays
+        a_num = num.array(a_np.T).T
+        b_num = num.array(b_np.T).T
+    else:
+        a_num = num.array(a_np)
+        b_num = num.array(b_np)
+
+    assert np.allclose(np.matmul(a_np, b_np), num.matmul(a_num, b_num))
+
+
+# Transposed slices of larger arrays, whose instances the promoted operands
+# of the matrix multiply reuse with a wider pitch
+def test_transposed_slices():
+    a_np = np.random.rand(60, 40)
+    b_np = np.random.rand(50, 70)
+    a_num = num.array(a_np)[5:58, 3:40].T
+    b_num = num.array(b_np)[1:30, 2:55].T
+    res_np = np.matmul(a_np[5:58, 3:40].T, b_np[1:30, 2:55].T)
+    assert np.allclose(res_np, num.matmul(a_num, b_num))
+
+
+def test_summa_transposed_out(monkeypatch):
+    monkeypatch.setattr(summa, "MIN_SUMMA_MATRIX_SIZE", 1)
+    monkeypatch.setattr(summa, "MIN_SUMMA_PROCS", 1)
+    a_np = np.random.rand(37, 53)
+    b_np = np.random.rand(53, 29)
+    out = num.zeros((29, 37))
+    num.matmul(num.array(a_np), num.array(b_np), out=out.T)
+    assert np.allclose(np.matmul(a_np, b_np), out.T)
+
+
+# Products of int8 values overflow int8, so this also checks that the
+# results wrap around the same way as in NumPy
+@pytest.mark.parametrize("shapes", [((37, 53), (53, 29)), ((37, 53), (53,))])
+def test_int8(shapes):
+    a_shape, b_shape = shapes
+    a_np = np.random.randint(-128, 128, size=a_shape, dtype=np.int8)
+    b_np = np.random.randint(-128, 128, size=b_shape, dtype=np.int8)
+    a_num = num.array(a_np)
+    b_num = num.array(b_np)
+
+    res_np = np.matmul(a_np, b_np)
+    res_num = num.matmul(a_num, b_num)
+    assert res_num.dtype == np.int8
+    assert np.array_equal(res_np, res_num)
+
+    res_np = np.matmul(b_np.T, a_np.T)
+    res_num = num.matmul(b_num.T, a_num.T)
+    assert np.array_equal(res_np, res_num)
+
+
+@pytest.mark.parametrize(
+    "shapes", [((37, 53), (53, 29)), ((37, 53), (53,)), ((53,), (53,))]
+)
+def test_int8_to_int32(shapes):
+    a_shape, b_shape = shapes
+    a_np = np.random.randint(-128, 128, size=a_shape, dtype=np.int8)
+    b_np = np.random.randint(-128, 128, size=b_shape, dtype=np.int8)
+    a_num = num.array(a_np)
+    b_num = num.array(b_np)
+
+    res_np = np.matmul(a_np, b_np, dtype=np.int32)
+    res_num = num.matmul(a_num, b_num, dtype=np.int32)
+    assert res_num.dtype == np.int32
+    assert np.array_equal(res_np, res_num)
+
+    out = num.zeros(res_np.shape, dtype=np.int32)
+    num.matmul(a_num, b_num, out=out)
+    assert np.array_equal(res_np, out)
+
+
+@pytest.mark.parametrize("batch", [1, 7, 100])
+@pytest.mark.parametrize("dtype", [np.float16, np.float64, np.complex64])
+def test_batched(batch, dtype):
+    a_np = np.random.rand(batch, 9, 5).astype(dtype)
+    b_np = np.random.rand(batch, 5, 6).astype(dtype)
+    a_num = num.array(a_np)
+    b_num = num.array(b_np)
+    rtol = 1e-2 if dtype == np.float16 else 1e-5
+
+    res_np = np.matmul(a_np, b_np)
+    res_num = num.matmul(a_num, b_num)
+    assert res_num.dtype == res_np.dtype
+    assert np.allclose(res_np, res_num, rtol=rtol)
+
+    # Transposed matrices within the batch
+    res_np = np.matmul(b_np.swapaxes(1, 2), a_np.swapaxes(1, 2))
+    res_num = num.matmul(b_num.swapaxes(1, 2), a_num.swapaxes(1, 2))
+    assert np.allclose(res_np, res_num, rtol=rtol)
+
+
+def test_batched_transposed_out():
+    a_np = np.random.rand(5, 9, 4)
+    b_np = np.random.rand(5, 4, 6)
+    out = num.zeros((5, 6, 9))
+    num.matmul(num.array(a_np), num.array(b_np), out=out.swapaxes(1, 2))
+    assert np.allclose(np.matmul(a_np, b_np), out.swapaxes(1, 2))
+
+
 if __name__ == "__main__":
     import sys
 
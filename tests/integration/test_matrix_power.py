@@ -20,8 +20,8 @@ from test_tools.generators import mk_0to1_array
 import cunumeric as cn
 from legate.core import LEGATE_MAX_DIM
 
-# TODO: add negative exponents here, once they become supported
 EXPONENTS = [0, 1, 3, 5]
+NEGATIVE_EXPONENTS = [-1, -3]
 
 
 @pytest.mark.parametrize("ndim", range(0, LEGATE_MAX_DIM - 2))
@@ -35,6 +35,17 @@ def test_matrix_power(ndim, exp):
     assert np.allclose(np_res, cn_res)
 
 
+# TODO: test stacked arrays, once inv supports them
+@pytest.mark.parametrize("exp", NEGATIVE_EXPONENTS)
+def test_matrix_power_negative(exp):
+    shape = (2, 2)
+    np_a = mk_0to1_array(np, shape)
+    cn_a = mk_0to1_array(cn, shape)
+    np_res = np.linalg.matrix_power(np_a, exp)
+    cn_res = cn.linalg.matrix_power(cn_a, exp)
+    assert np.allclose(np_res, cn_res)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -0,0 +1,240 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SHAPES = ((1000,), (64, 33), (7, 20, 13))
+
+DTYPES = (np.bool_, np.int16, np.float16, np.float32, np.complex128)
+
+
+def make_array(shape, dtype):
+    return (np.arange(np.prod(shape)) % 251).reshape(shape).astype(dtype)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+@pytest.mark.parametrize("dtype", DTYPES)
+def test_load(tmp_path, shape, dtype):
+    path = tmp_path / "a.npy"
+    a = make_array(shape, dtype)
+    np.save(path, a)
+    b = num.load(path)
+    assert isinstance(b, num.ndarray)
+    assert b.dtype == a.dtype
+    assert np.array_equal(a, b)
+
+
+@pytest.mark.parametrize("shape", ((64, 33), (40, 30, 5)))
+@pytest.mark.parametrize("dtype", (np.int16, np.float64))
+def test_load_fortran_order(tmp_path, shape, dtype):
+    # The task writes through a transposed view of the output, which isn't
+    # contiguous where the file is
+    path = tmp_path / "a.npy"
+    a = np.asfortranarray(make_array(shape, dtype))
+    np.save(path, a)
+    assert np.array_equal(a, num.load(path))
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+@pytest.mark.parametrize("dtype", DTYPES)
+def test_save(tmp_path, shape, dtype):
+    path = tmp_path / "a"
+    a = make_array(shape, dtype)
+    num.save(path, num.array(a))
+    b = np.load(tmp_path / "a.npy")
+    assert b.dtype == a.dtype
+    assert np.array_equal(a, b)
+
+
+def test_round_trip_view(tmp_path):
+    path = tmp_path / "a.npy"
+    a = num.arange(600.0).reshape(20, 30)
+    num.save(path, a[2:18:3, ::-2].T)
+    assert num.array_equal(num.load(path), a[2:18:3, ::-2].T)
+
+
+def test_fallback(tmp_path):
+    path = tmp_path / "a.npy"
+    a = make_array((100,), ">i4")
+    np.save(path, a)
+    assert np.array_equal(a, num.load(path))
+    num.save(path, np.float64(3.0))
+    assert num.load(path) == 3.0
+
+
+@pytest.mark.parametrize("compressed", (False, True))
+def test_load_npz(tmp_path, compressed):
+    path = tmp_path / "a.npz"
+    a = make_array((50, 20), np.float32)
+    b = make_array((300,), np.int64)
+    savez = np.savez_compressed if compressed else np.savez
+    savez(path, a, b=b)
+    with num.load(path) as npz:
+        assert sorted(npz.files) == ["arr_0", "b"]
+        assert np.array_equal(npz["arr_0"], a)
+        assert np.array_equal(npz["b"], b)
+
+
+@pytest.mark.parametrize("mode", ("r", "c"))
+def test_memmap(tmp_path, mode):
+    path = tmp_path / "a.bin"
+    a = make_array((70, 30), np.float32)
+    with open(path, "wb") as f:
+        f.write(b"x" * 100)
+        a.tofile(f)
+    b = num.memmap(
+        path, dtype=np.float32, mode=mode, offset=100, shape=a.shape
+    )
+    assert np.array_equal(a, b)
+    c = num.memmap(path, dtype=np.float32, mode=mode, offset=100)
+    assert np.array_equal(a.ravel(), c)
+
+
+def test_memmap_copy_on_write(tmp_path):
+    path = tmp_path / "a.bin"
+    a = make_array((1000,), np.int32)
+    a.tofile(path)
+    b = num.memmap(path, dtype=np.int32, mode="c")
+    b += 1
+    assert np.array_equal(a + 1, b)
+    assert np.array_equal(a, np.fromfile(path, dtype=np.int32))
+
+
+def test_memmap_read_write(tmp_path):
+    path = tmp_path / "a.bin"
+    a = make_array((1000,), np.int32)
+    a.tofile(path)
+    b = num.memmap(path, dtype=np.int32, mode="r+")
+    b[:10] = -1
+    a[:10] = -1
+    del b
+    assert np.array_equal(a, np.fromfile(path, dtype=np.int32))
+
+
+@pytest.mark.parametrize("order", ("C", "F"))
+def test_load_mmap(tmp_path, order):
+    path = tmp_path / "a.npy"
+    a = np.asarray(make_array((40, 30, 5), np.float64), order=order)
+    np.save(path, a)
+    assert np.array_equal(a, num.load(path, mmap_mode="r"))
+
+
+CHUNKS = ((64,), (10, 7), (3, 20, 5))
+
+
+@pytest.mark.parametrize("shape,chunks", zip(SHAPES, CHUNKS))
+@pytest.mark.parametrize("dtype", DTYPES)
+def test_chunked_round_trip(tmp_path, shape, chunks, dtype):
+    a = make_array(shape, dtype)
+    num.save_chunked(tmp_path / "a", num.array(a), chunks=chunks)
+    b = num.load_chunked(tmp_path / "a")
+    assert b.dtype == a.dtype
+    assert np.array_equal(a, b)
+
+
+@pytest.mark.parametrize("level", (None, 0, 9))
+@pytest.mark.parametrize("shuffle", (False, True))
+def test_chunked_codecs(tmp_path, level, shuffle):
+    a = make_array((300, 40), np.float64)
+    num.save_chunked(
+        tmp_path / "a", a, chunks=64, compression_level=level, shuffle=shuffle
+    )
+    assert np.array_equal(a, num.load_chunked(tmp_path / "a"))
+
+
+def test_chunked_missing_chunk(tmp_path):
+    a = make_array((100, 10), np.int32)
+    num.save_chunked(tmp_path / "a", a, chunks=(30, 10))
+    (tmp_path / "a" / "1.0").unlink()
+    a[30:60] = 0
+    assert np.array_equal(a, num.load_chunked(tmp_path / "a"))
+
+
+def test_chunked_corrupt(tmp_path):
+    num.save_chunked(tmp_path / "a", make_array((100,), np.int64), chunks=50)
+    (tmp_path / "a" / "1").write_bytes(b"garbage")
+    with pytest.raises(OSError):
+        num.load_chunked(tmp_path / "a")
+
+
+def test_chunked_invalid(tmp_path):
+    a = num.arange(10)
+    with pytest.raises(ValueError):
+        num.save_chunked(tmp_path / "a", a, chunks=(5, 5))
+    with pytest.raises(ValueError):
+        num.save_chunked(tmp_path / "a", a, compression_level=10)
+
+
+@pytest.mark.parametrize("delimiter", (None, ","))
+@pytest.mark.parametrize("dtype", (np.int32, np.uint8, np.float32, np.float64))
+def test_loadtxt(tmp_path, delimiter, dtype):
+    path = tmp_path / "a.txt"
+    a = make_array((2000, 7), dtype)
+    np.savetxt(path, a, fmt="%s", delimiter=delimiter or " ", header="x y")
+    b = num.loadtxt(path, dtype=dtype, delimiter=delimiter)
+    assert b.dtype == a.dtype
+    assert np.array_equal(a, b)
+
+
+def test_loadtxt_options(tmp_path):
+    path = tmp_path / "a.txt"
+    path.write_text(
+        "skipped\n1, 2, 3 ; comment\n\n  4,5,6\r\n; only a comment\n7,8,9"
+    )
+    kwargs = dict(delimiter=",", comments=";", skiprows=1)
+    for usecols in (None, 1, (2, 0), [-1]):
+        for ndmin in (0, 1, 2):
+            a = np.loadtxt(path, usecols=usecols, ndmin=ndmin, **kwargs)
+            b = num.loadtxt(path, usecols=usecols, ndmin=ndmin, **kwargs)
+            assert a.shape == b.shape
+            assert np.array_equal(a, b)
+    x, y, z = num.loadtxt(path, unpack=True, **kwargs)
+    assert np.array_equal(y, [2, 5, 8])
+
+
+def test_loadtxt_errors(tmp_path):
+    path = tmp_path / "a.txt"
+    path.write_text("1 2\n3 4\n5\n")
+    with pytest.raises(ValueError):
+        num.loadtxt(path)
+    path.write_text("1 2\n3 x\n")
+    with pytest.raises(ValueError):
+        num.loadtxt(path)
+
+
+def test_genfromtxt(tmp_path):
+    path = tmp_path / "a.txt"
+    path.write_text("# a, b\n1,2.5\n3,\n,x\n")
+    a = np.genfromtxt(path, delimiter=",")
+    b = num.genfromtxt(path, delimiter=",")
+    assert np.array_equal(a, b, equal_nan=True)
+
+
+def test_truncated(tmp_path):
+    path = tmp_path / "a.npy"
+    np.save(path, make_array((1000,), np.float64))
+    with open(path, "r+b") as f:
+        f.truncate(2000)
+    with pytest.raises(ValueError):
+        num.load(path)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
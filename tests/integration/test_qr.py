@@ -0,0 +1,77 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SHAPES = [(8, 8), (9, 3), (3, 9), (1000, 10), (255, 64)]
+
+
+def check_qr(a, q, r):
+    m, n = a.shape
+    k = min(m, n)
+    assert q.shape == (m, k)
+    assert r.shape == (k, n)
+    assert num.allclose(num.triu(r), r)
+    assert num.allclose(q.T.conj() @ q, num.eye(k))
+    assert num.allclose(q @ r, a)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+def test_real(shape):
+    a = num.random.rand(*shape)
+    q, r = num.linalg.qr(a)
+    check_qr(a, q, r)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+def test_complex(shape):
+    a = num.random.rand(*shape) + num.random.rand(*shape) * 1.0j
+    q, r = num.linalg.qr(a)
+    check_qr(a, q, r)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+def test_mode_r(shape):
+    a = num.random.rand(*shape)
+    r = num.linalg.qr(a, mode="r")
+    r_np = np.linalg.qr(a.__array__(), mode="r")
+    # The factors are only unique up to the signs of the rows of r
+    assert num.allclose(abs(r), abs(r_np))
+
+
+def test_int():
+    a = num.arange(12).reshape((4, 3))
+    q, r = num.linalg.qr(a)
+    assert q.dtype == np.float64
+    check_qr(a, q, r)
+
+
+def test_unsupported_modes():
+    a = num.random.rand(4, 3)
+    with pytest.raises(NotImplementedError):
+        num.linalg.qr(a, mode="raw")
+    with pytest.raises(NotImplementedError):
+        num.linalg.qr(a, mode="complete")
+    with pytest.raises(ValueError):
+        num.linalg.qr(a, mode="foo")
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -17,6 +17,44 @@ import numpy as np
 import pytest
 
 import cunumeric as cn
+from cunumeric.random import Generator, Philox
+
+PHILOX_M = (0xD2511F53, 0xCD9E8D57)
+PHILOX_W = (0x9E3779B9, 0xBB67AE85)
+
+
+# Returns the four words of Philox-4x32-10 for the 128-bit counter (ctr, 0)
+def philox_words(key, ctr):
+    k0, k1 = key
+    c0, c1, c2, c3 = ctr & 0xFFFFFFFF, ctr >> 32, 0, 0
+    for _ in range(10):
+        p0 = c0 * PHILOX_M[0]
+        p1 = c2 * PHILOX_M[1]
+        c0, c1, c2, c3 = (
+            (p1 >> 32) ^ c1 ^ k0,
+            p1 & 0xFFFFFFFF,
+            (p0 >> 32) ^ c3 ^ k1,
+            p0 & 0xFFFFFFFF,
+        )
+        k0 = (k0 + PHILOX_W[0]) & 0xFFFFFFFF
+        k1 = (k1 + PHILOX_W[1]) & 0xFFFFFFFF
+    return c0, c1, c2, c3
+
+
+# The uniform values for the linear offsets [lo, hi) of a draw. A float64
+# takes two words and a float32 one, from the lanes of counter + i / lanes.
+def reference_uniform(key, counter, lo, hi, dtype):
+    lanes = 2 if dtype == np.float64 else 4
+    out = np.empty(hi - lo, dtype=dtype)
+    for i in range(lo, hi):
+        words = philox_words(key, counter + i // lanes)
+        lane = i % lanes
+        if dtype == np.float64:
+            bits = (words[2 * lane] << 32) | words[2 * lane + 1]
+            out[i - lo] = (bits >> 12) * 2.0**-52
+        else:
+            out[i - lo] = (words[lane] >> 8) * 2.0**-24
+    return out
 
 
 @pytest.mark.xfail
@@ -28,6 +66,48 @@ def test_randn():
     assert np.allclose(x, xn)
 
 
+@pytest.mark.parametrize("shape", [(1,), (1000,), (17, 33), (4, 5, 301)])
+def test_rand_range(shape):
+    x = cn.random.rand(*shape)
+    assert x.shape == shape
+    assert cn.all(x >= 0) and cn.all(x < 1)
+
+
+def test_rand_independent_of_shape():
+    # Each value depends only on its linear offset, so a small draw is a
+    # prefix of a large one however either of them is partitioned
+    cn.random.seed(7)
+    x = cn.random.rand(1 << 20)
+    cn.random.seed(7)
+    y = cn.random.rand(25, 40)
+    assert np.array_equal(np.asarray(x)[:1000], np.asarray(y).reshape(-1))
+
+
+def test_rand_reference_slice():
+    cn.random.seed(11)
+    x = cn.random.rand(1 << 16)
+    lo, hi = 40000, 40100
+    ref = reference_uniform((11, 0), 0, lo, hi, np.float64)
+    assert np.array_equal(np.asarray(x)[lo:hi], ref)
+
+
+@pytest.mark.parametrize("shape", [(1000,), (40, 25)])
+def test_random_float32(shape):
+    # The values come from single words, not from float64 values converted
+    # to float32, which could round up to 1
+    counter = 123
+    key = 0x0123456789ABCDEF
+    x = Generator(Philox(key=key, counter=counter)).random(
+        shape, dtype=np.float32
+    )
+    assert x.dtype == np.float32
+    assert x.shape == shape
+    ref = reference_uniform(
+        (key & 0xFFFFFFFF, key >> 32), counter, 0, x.size, np.float32
+    )
+    assert np.array_equal(np.asarray(x).reshape(-1), ref)
+
+
 if __name__ == "__main__":
     import sys
 
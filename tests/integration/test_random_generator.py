@@ -0,0 +1,178 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SIZE = 100000
+
+
+def test_reproducible():
+    x = num.random.default_rng(42).random((100, 50))
+    y = num.random.default_rng(42).random((100, 50))
+    assert num.array_equal(x, y)
+
+
+def test_successive_draws_differ():
+    rng = num.random.default_rng(42)
+    assert not num.array_equal(rng.random(1000), rng.random(1000))
+
+
+def test_spawn():
+    children = num.random.default_rng(42).spawn(2)
+    x = children[0].random(1000)
+    y = children[1].random(1000)
+    assert not num.array_equal(x, y)
+
+
+@pytest.mark.parametrize("dtype", (np.float16, np.float32, np.float64))
+def test_random_dtype(dtype):
+    x = num.random.default_rng(1).random(SIZE, dtype=dtype)
+    assert x.dtype == dtype
+    assert num.all(x >= 0) and num.all(x < 1)
+
+
+def test_integers():
+    x = num.random.default_rng(2).integers(-5, 5, size=SIZE, dtype=np.int32)
+    assert x.dtype == np.int32
+    assert int(x.min()) == -5 and int(x.max()) == 4
+    y = num.random.default_rng(2).integers(3, size=SIZE, endpoint=True)
+    assert int(y.min()) == 0 and int(y.max()) == 3
+
+
+def check_moments(x, mean, var):
+    sample_mean = float(x.mean())
+    sample_var = float(((x - sample_mean) ** 2).mean())
+    assert abs(sample_mean - mean) < 0.05 * max(1.0, abs(mean))
+    assert abs(sample_var - var) < 0.1 * max(1.0, var)
+
+
+LOGNORMAL_VAR = (np.exp(0.25) - 1) * np.exp(0.25)
+
+DISTRIBUTIONS = (
+    ("uniform", (2.0, 5.0), 3.5, 0.75),
+    ("normal", (3.0, 2.0), 3.0, 4.0),
+    ("exponential", (2.0,), 2.0, 4.0),
+    ("lognormal", (0.0, 0.5), np.exp(0.125), LOGNORMAL_VAR),
+    ("gamma", (0.5, 2.0), 1.0, 2.0),
+    ("gamma", (4.0, 1.0), 4.0, 4.0),
+    ("beta", (2.0, 5.0), 2.0 / 7.0, 10.0 / 392.0),
+    ("beta", (0.5, 0.5), 0.5, 0.125),
+    ("poisson", (3.0,), 3.0, 3.0),
+    ("poisson", (100.0,), 100.0, 100.0),
+    ("binomial", (10, 0.3), 3.0, 2.1),
+    ("binomial", (1000, 0.6), 600.0, 240.0),
+)
+
+
+@pytest.mark.parametrize("name,args,mean,var", DISTRIBUTIONS)
+def test_distribution(name, args, mean, var):
+    rng = num.random.default_rng(3)
+    x = getattr(rng, name)(*args, size=SIZE)
+    assert x.shape == (SIZE,)
+    check_moments(x, mean, var)
+
+
+@pytest.mark.parametrize("method", ("box-muller", "ziggurat"))
+def test_normal_method(method):
+    rng = num.random.default_rng(14)
+    x = rng.standard_normal(SIZE, dtype=np.float32, method=method)
+    assert x.dtype == np.float32
+    check_moments(x, 0.0, 1.0)
+    check_moments(rng.normal(3.0, 2.0, size=SIZE, method=method), 3.0, 4.0)
+    with pytest.raises(ValueError):
+        rng.normal(method="polar")
+
+
+def test_scalar():
+    value = num.random.default_rng(4).standard_normal()
+    assert np.isscalar(value)
+
+
+def test_multivariate_normal():
+    mean = np.array([1.0, -1.0])
+    cov = np.array([[2.0, 0.5], [0.5, 1.0]])
+    x = num.random.default_rng(5).multivariate_normal(mean, cov, size=SIZE)
+    assert x.shape == (SIZE, 2)
+    centered = np.asarray(x) - mean
+    assert np.allclose(centered.T @ centered / SIZE, cov, atol=0.05)
+
+
+def test_permutation():
+    perm = num.random.default_rng(6).permutation(SIZE)
+    assert num.array_equal(num.sort(perm), num.arange(SIZE))
+    assert not num.array_equal(perm, num.arange(SIZE))
+
+
+def test_permutation_axis():
+    x = num.arange(60).reshape(3, 20)
+    y = num.random.default_rng(7).permutation(x, axis=1)
+    assert num.array_equal(num.sort(y, axis=1), x)
+    # The same permutation applies to every row
+    assert bool(num.all(y[1] - y[0] == 20))
+
+
+def test_shuffle():
+    x = num.arange(SIZE)
+    num.random.default_rng(8).shuffle(x)
+    assert num.array_equal(num.sort(x), num.arange(SIZE))
+
+
+def test_choice_replace():
+    a = num.arange(10, 20)
+    x = num.random.default_rng(9).choice(a, size=SIZE)
+    assert int(x.min()) == 10 and int(x.max()) == 19
+
+
+def test_choice_no_replace():
+    x = num.random.default_rng(10).choice(SIZE, size=1000, replace=False)
+    assert num.unique(x).size == 1000
+
+
+def test_choice_weighted():
+    p = np.array([0.1, 0.0, 0.6, 0.3])
+    x = num.random.default_rng(11).choice(4, size=SIZE, p=p)
+    counts = np.bincount(np.asarray(x), minlength=4) / SIZE
+    assert np.allclose(counts, p, atol=0.01)
+    y = num.random.default_rng(12).choice(4, size=3, replace=False, p=p)
+    assert sorted(np.asarray(y).tolist()) == [0, 2, 3]
+
+
+def test_legacy():
+    num.random.seed(13)
+    x = num.random.permutation(100)
+    num.random.seed(13)
+    y = num.random.permutation(100)
+    assert num.array_equal(x, y)
+    assert num.random.choice(5) in range(5)
+
+
+def test_legacy_permutation_independent_of_rand():
+    # The legacy permutation must not reuse the bits of rand for the same
+    # seed, or it would be the order that sorts those values
+    num.random.seed(14)
+    x = np.asarray(num.random.rand(SIZE))
+    num.random.seed(14)
+    perm = np.asarray(num.random.permutation(SIZE))
+    assert not np.array_equal(perm, np.argsort(x))
+    assert abs(np.corrcoef(x[perm], np.arange(SIZE))[0, 1]) < 0.05
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -17,6 +17,7 @@ import numpy as np
 import pytest
 
 import cunumeric as num
+from cunumeric.runtime import runtime
 
 SQUARE_CASES = [
     (10, 5, 2),
@@ -96,6 +97,53 @@ class TestRect:
         )
 
 
+UNIT_CASES = [
+    ((1, 200), (200,)),
+    ((200,), (1, 200)),
+    ((1, 20, 1, 10), (20, 10, 1)),
+    ((1, 1), ()),
+    ((), (1, 1, 1)),
+]
+
+
+@pytest.mark.parametrize("shapes", UNIT_CASES, ids=str)
+def test_unit_extents(shapes):
+    in_shape, out_shape = shapes
+    anp = np.arange(np.prod(in_shape)).reshape(in_shape)
+    a = num.array(anp)
+    b = a.reshape(out_shape)
+    assert np.array_equal(b, anp.reshape(out_shape))
+    # These reshapes are views, as in NumPy
+    b.fill(-1)
+    assert bool((a == -1).all())
+
+
+@pytest.mark.parametrize("shape", RECT_CASES + [(200,), (4, 50)], ids=str)
+def test_fortran_order(shape):
+    anp = np.random.rand(5, 4, 10)
+    a = num.array(anp)
+    assert np.array_equal(
+        a.reshape(shape, order="F"), anp.reshape(shape, order="F")
+    )
+    assert np.array_equal(num.ravel(a, order="F"), np.ravel(anp, order="F"))
+
+
+@pytest.mark.parametrize("eager", (False, True))
+@pytest.mark.parametrize("shape", ((1, 12), (3, 4)))
+def test_flatten_copies(monkeypatch, eager, shape):
+    if eager:
+        # Test mode turns off eager execution, and eager thunks reshape
+        # contiguous arrays into NumPy views
+        monkeypatch.setattr(runtime.args, "test_mode", False)
+        monkeypatch.setattr(runtime, "max_eager_volume", 1024)
+    a = num.arange(12).reshape(shape)
+    if eager:
+        assert runtime.is_eager_array(a._thunk)
+    b = a.flatten()
+    b.fill(-1)
+    assert np.array_equal(a, np.arange(12).reshape(shape))
+
+
 if __name__ == "__main__":
     import sys
 
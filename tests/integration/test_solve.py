@@ -0,0 +1,94 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SIZES = [1, 8, 9, 255, 512]
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_vector(n):
+    a = num.random.rand(n, n) + num.eye(n) * n
+    b = num.random.rand(n)
+    x = num.linalg.solve(a, b)
+    x_np = np.linalg.solve(a.__array__(), b.__array__())
+    assert x.shape == b.shape
+    assert num.allclose(x, x_np)
+
+
+@pytest.mark.parametrize("n", SIZES)
+@pytest.mark.parametrize("k", [1, 5])
+def test_matrix(n, k):
+    a = num.random.rand(n, n) + num.eye(n) * n
+    b = num.random.rand(n, k)
+    x = num.linalg.solve(a, b)
+    x_np = np.linalg.solve(a.__array__(), b.__array__())
+    assert num.allclose(x, x_np)
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_complex(n):
+    a = num.random.rand(n, n) + num.random.rand(n, n) * 1.0j
+    a += num.eye(n) * n
+    b = num.random.rand(n, 3) + num.random.rand(n, 3) * 1.0j
+    x = num.linalg.solve(a, b)
+    x_np = np.linalg.solve(a.__array__(), b.__array__())
+    assert num.allclose(x, x_np)
+
+
+def test_pivoting():
+    # The leading entry is zero, so this only succeeds with row interchanges
+    a = num.array([[0.0, 1.0, 2.0], [1.0, 0.0, 3.0], [4.0, -3.0, 8.0]])
+    b = num.array([1.0, 2.0, 3.0])
+    x = num.linalg.solve(a, b)
+    assert num.allclose(num.dot(a, x), b)
+
+
+def test_int():
+    a = num.array([[2, 1], [1, 3]])
+    b = num.array([1, 2])
+    x = num.linalg.solve(a, b)
+    assert x.dtype == np.float64
+    assert num.allclose(x, np.linalg.solve(a.__array__(), b.__array__()))
+
+
+@pytest.mark.parametrize("n", SIZES)
+def test_inv(n):
+    a = num.random.rand(n, n) + num.eye(n) * n
+    a_inv = num.linalg.inv(a)
+    assert num.allclose(num.dot(a, a_inv), num.eye(n))
+
+
+def test_singular():
+    a = num.ones((4, 4))
+    b = num.ones((4,))
+    with pytest.raises(num.linalg.LinAlgError):
+        num.linalg.solve(a, b)
+
+
+def test_not_square():
+    a = num.ones((4, 3))
+    b = num.ones((4,))
+    with pytest.raises(num.linalg.LinAlgError):
+        num.linalg.solve(a, b)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
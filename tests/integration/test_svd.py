@@ -0,0 +1,72 @@
+# Copyright 2022 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import numpy as np
+import pytest
+
+import cunumeric as num
+
+SHAPES = [(1, 1), (8, 8), (9, 3), (3, 9), (1000, 10)]
+
+
+def check_svd(a, u, s, vh):
+    m, n = a.shape
+    k = min(m, n)
+    assert u.shape[0] == m
+    assert vh.shape[1] == n
+    assert num.allclose(u.T.conj() @ u, num.eye(u.shape[1]))
+    assert num.allclose(vh @ vh.T.conj(), num.eye(vh.shape[0]))
+    assert num.allclose((u[:, :k] * s) @ vh[:k], a)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+@pytest.mark.parametrize("full_matrices", [False, True])
+def test_real(shape, full_matrices):
+    a = num.random.rand(*shape)
+    u, s, vh = num.linalg.svd(a, full_matrices=full_matrices)
+    s_np = np.linalg.svd(a.__array__(), compute_uv=False)
+    assert num.allclose(s, s_np)
+    k = min(shape)
+    if full_matrices:
+        assert u.shape == (shape[0], shape[0])
+        assert vh.shape == (shape[1], shape[1])
+    else:
+        assert u.shape == (shape[0], k)
+        assert vh.shape == (k, shape[1])
+    check_svd(a, u, s, vh)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+def test_complex(shape):
+    a = num.random.rand(*shape) + num.random.rand(*shape) * 1.0j
+    u, s, vh = num.linalg.svd(a, full_matrices=False)
+    s_np = np.linalg.svd(a.__array__(), compute_uv=False)
+    assert s.dtype == s_np.dtype
+    assert num.allclose(s, s_np)
+    check_svd(a, u, s, vh)
+
+
+@pytest.mark.parametrize("shape", SHAPES)
+def test_values_only(shape):
+    a = num.random.rand(*shape)
+    s = num.linalg.svd(a, compute_uv=False)
+    s_np = np.linalg.svd(a.__array__(), compute_uv=False)
+    assert num.allclose(s, s_np)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
@@ -199,6 +199,34 @@ def test_all():
     check_ops(ops, (np.array(np.inf),))
 
 
+@pytest.mark.parametrize("dtype", ("e", "f", "d"))
+@pytest.mark.parametrize("op", ("exp", "log", "sin", "cos", "tanh"))
+def test_transcendental(op, dtype):
+    # Enough values to span several blocks of the vectorized kernels, along
+    # with the special values and arguments that need a libm fallback
+    finfo = np.finfo(dtype)
+    special = [0.0, -0.0, np.inf, -np.inf, np.nan, finfo.tiny, -1.0, 1e4]
+    if dtype != "e":
+        special += [finfo.tiny / 4, 100.0, -100.0, 1e10]
+    in_np = np.concatenate(
+        (np.linspace(-20, 20, 1000, dtype=dtype), np.array(special, dtype))
+    )
+    in_num = num.array(in_np)
+
+    with np.errstate(all="ignore"):
+        out_np = getattr(np, op)(in_np)
+        out_num = getattr(num, op)(in_num)
+
+    rtol = 1e-3 if dtype == "e" else 1e-6 if dtype == "f" else 1e-13
+    assert out_np.dtype == out_num.dtype
+    assert np.allclose(out_np, out_num, rtol=rtol, atol=0, equal_nan=True)
+    # Zeros and infinities must come out with the right sign
+    numbers = ~np.isnan(out_np)
+    assert np.array_equal(
+        np.signbit(out_np[numbers]), np.signbit(np.asarray(out_num)[numbers])
+    )
+
+
 def parse_inputs(in_str, dtype_str):
     dtypes = tuple(np.dtype(dtype) for dtype in dtype_str.split(":"))
     tokens = in_str.split(":")